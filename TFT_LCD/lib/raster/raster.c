@@ -0,0 +1,81 @@
+#include <string.h>
+#include "raster.h"
+
+static int32_t ceil_div(int64_t n, int64_t d) {
+    return (n >= 0) ? (n+d-1)/d : -(-n/d);
+}
+
+static int32_t floor_div(int64_t n, int64_t d) {
+    return (n >= 0) ? n/d : -((-n+d-1)/d);
+}
+
+int row_of(int Y) {
+    return ceil_div(Y-HALF, ONE);
+}
+
+void edge_init(Edge *e, int X0, int Y0, int X1, int Y1, int y) {
+    int64_t dx = X1-X0, dy = Y1-Y0;
+    int64_t n = (X0-HALF)*dy + ((int64_t)y*ONE+HALF-Y0)*dx;  // Edge x of the row's center, times d
+    e->d = ONE*dy;
+    e->q = ceil_div(n, e->d);
+    e->r = (int64_t)e->q*e->d - n;
+    e->a = floor_div(ONE*dx, e->d);
+    e->b = ONE*dx - (int64_t)e->a*e->d;
+}
+
+// Rasterize one half of a triangle, rows y..end-1, between the edges l and r
+static void tri_rows(Target *t, Edge *l, Edge *r, int y, int end, uint16_t c) {
+    if(t->rows && y<end) memset(t->rows+y, 1, end-y);
+    uint16_t *row = t->px+(y-t->y1)*t->stride;
+    for(; y<end; y++, row+=t->stride) {
+        int x1 = (l->q>t->x1)?l->q:t->x1, x2 = (r->q<t->x2)?r->q:t->x2;
+        if(x1<x2) span(row+x1-t->x1, x2-x1, c);
+        edge_step(l);
+        edge_step(r);
+    }
+}
+
+void tri_fx(Target *t, int X0, int Y0, int X1, int Y1, int X2, int Y2, uint16_t c) {
+    if(Y0>Y1){int s=Y0;Y0=Y1;Y1=s;s=X0;X0=X1;X1=s;}
+    if(Y0>Y2){int s=Y0;Y0=Y2;Y2=s;s=X0;X0=X2;X2=s;}
+    if(Y1>Y2){int s=Y1;Y1=Y2;Y2=s;s=X1;X1=X2;X2=s;}
+    int64_t cross = (int64_t)(X1-X0)*(Y2-Y0) - (int64_t)(Y1-Y0)*(X2-X0);
+    if(cross == 0) return;
+    int ys = row_of(Y0), ym = row_of(Y1), ye = row_of(Y2);
+    if(ys<t->y1)ys=t->y1;
+    if(ye>t->y2)ye=t->y2;
+    if(ys>=ye)return;
+    // cross > 0 puts the middle vertex right of the long edge
+    Edge lng, sht;
+    edge_init(&lng, X0, Y0, X2, Y2, ys);
+    if(ys<ym) {
+        int end=(ym<ye)?ym:ye;
+        edge_init(&sht, X0, Y0, X1, Y1, ys);
+        if(cross>0) tri_rows(t, &lng, &sht, ys, end, c);
+        else tri_rows(t, &sht, &lng, ys, end, c);
+        ys = end;
+    }
+    if(ys<ye) {
+        edge_init(&sht, X1, Y1, X2, Y2, ys);
+        if(cross>0) tri_rows(t, &lng, &sht, ys, ye, c);
+        else tri_rows(t, &sht, &lng, ys, ye, c);
+    }
+}
+
+void tri_ref(Target *t, int X0, int Y0, int X1, int Y1, int X2, int Y2, uint16_t c) {
+    int64_t area = (int64_t)(X1-X0)*(Y2-Y0) - (int64_t)(Y1-Y0)*(X2-X0);
+    if(area == 0) return;
+    if(area < 0) {int s=X1;X1=X2;X2=s;s=Y1;Y1=Y2;Y2=s;}
+    const int v[4][2] = {{X0,Y0},{X1,Y1},{X2,Y2},{X0,Y0}};
+    for(int y=t->y1; y<t->y2; y++) {
+        for(int x=t->x1; x<t->x2; x++) {
+            bool in = true;
+            for(int k=0; k<3 && in; k++) {
+                int64_t nx = -(v[k+1][1]-v[k][1]), ny = v[k+1][0]-v[k][0];
+                int64_t e = nx*(x*ONE+HALF-v[k][0]) + ny*(y*ONE+HALF-v[k][1]);
+                in = e>0 || (e==0 && (nx>0 || (nx==0 && ny>0)));
+            }
+            if(in) t->px[(y-t->y1)*t->stride+(x-t->x1)] = c;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+// Pixel spans and the fixed-point triangle rasterizer, free of ESP-IDF so that the native tests build it
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Render target: the pixels of x1..x2-1, y1..y2-1, starting at px with stride pixels from row to row.
+// Primitives clip to it and flag the rows they touch in rows, when set.
+typedef struct {
+    uint16_t *px;
+    int stride;
+    int x1, y1, x2, y2;
+    uint8_t *rows;
+} Target;
+
+// 32-bit stores into pixel rows, two RGB565 pixels at a time
+typedef uint32_t __attribute__((may_alias)) Pair;
+
+// Fill n pixels from d with c: one 16-bit store to reach word alignment, then pairs
+static inline void span(uint16_t *d, int n, uint16_t c) {
+    if(n>0 && ((uintptr_t)d & 2)) { *d++=c; n--; }
+    uint32_t cc = c | (uint32_t)c<<16;
+    Pair *w = (Pair *)d;
+    for(; n>=2; n-=2) *w++ = cc;
+    if(n) *(uint16_t *)w = c;
+}
+
+// Triangle vertices are fixed point with SUB fraction bits; pixel x,y has its center at x+1/2, y+1/2.
+// A pixel is drawn when its center is inside, or on a left or top edge (the top-left rule), so triangles
+// sharing an edge never both draw a pixel of it.
+#define SUB 4
+#define ONE (1<<SUB)
+#define HALF (ONE/2)
+
+// Edge walked down the scanlines: q is the first pixel whose center is at or right of the edge on the
+// current row, and r/d the exact amount q overshoots it, so a row step is adds and one compare
+typedef struct {
+    int32_t q, r, d, a, b;  // One row moves the edge by a + b/d pixels
+} Edge;
+
+// First row whose center is at or below Y
+int row_of(int Y);
+
+// Edge from X0,Y0 down to X1,Y1 (Y1 > Y0), placed on row y
+void edge_init(Edge *e, int X0, int Y0, int X1, int Y1, int y);
+
+static inline void edge_step(Edge *e) {
+    e->q += e->a;
+    e->r -= e->b;
+    if(e->r < 0) { e->r += e->d; e->q++; }
+}
+
+// Fixed-point triangle: walks the long edge and the two short ones a row at a time, no divides per row
+void tri_fx(Target *t, int X0, int Y0, int X1, int Y1, int X2, int Y2, uint16_t c);
+
+// Reference for tri_fx(): tests every pixel center against the three edge functions. On an edge a pixel
+// is in when the edge's inward normal points right, or straight down.
+void tri_ref(Target *t, int X0, int Y0, int X1, int Y1, int X2, int Y2, uint16_t c);
@@ -4,6 +4,7 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
 #include "esp_lcd_panel_io.h"
@@ -11,6 +12,9 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_log.h"
 #include "esp_random.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "raster.h"
 
 static const char *TAG = "NY2026";
 
@@ -27,6 +31,8 @@ static const char *TAG = "NY2026";
 #define PIN_TCH_IRQ 47
 #define W 240
 #define H 320
+#define FPS 30
+#define FB_MODE 0  // 1: animate in the PSRAM framebuffer and present its dirty rows instead of dirty rects
 
 // Colors RGB565
 #define BLACK 0x0000
@@ -51,36 +57,154 @@ typedef struct {
     uint8_t size;
 } Snowflake;
 
-#define MAX_SNOW 50
+#define MAX_SNOW 150
 static Snowflake snow[MAX_SNOW];
 
-static void circ(esp_lcd_panel_handle_t p, int cx, int cy, int r, uint16_t c) {
-    for(int y=cy-r; y<=cy+r; y++)
-        for(int x=cx-r; x<=cx+r; x++)
-            if(y>=0&&y<H&&x>=0&&x<W&&(x-cx)*(x-cx)+(y-cy)*(y-cy)<=r*r)
-                esp_lcd_panel_draw_bitmap(p,x,y,x+1,y+1,&c);
+// Screen rectangle x1..x2-1, y1..y2-1
+typedef struct {
+    int x1, y1, x2, y2;
+} Rect;
+
+// Areas to redraw this frame: the old and new boxes of every flake, merged while that wastes few pixels
+#define MAX_DIRTY 128  // Room for about one rect per flake, so crowded frames still merge little
+#define DIRTY_SLACK 64  // Extra pixels a merge may cost; about what a draw_bitmap costs in commands
+static Rect dirty[MAX_DIRTY];
+static int n_dirty;
+
+// Band pipeline: the screen is rendered BAND_H rows at a time into one of two DMA buffers while the
+// band before it is on the bus; every finished color transfer frees a buffer for the next band.
+#define BAND_H 20
+static uint16_t *band_buf[2];
+static SemaphoreHandle_t band_free;  // One count per band buffer not in flight
+static int band_depth = 2;           // Buffers in rotation; 1 serializes rendering and SPI
+static unsigned band_next;           // Buffer of the next chunk, counted across rects
+
+// Full frame in PSRAM, NULL when there is none. The band buffers double as its DMA bounce buffers.
+static uint16_t *fb;
+static uint8_t fb_rows[H];  // Rows drawn since the last present
+
+static bool IRAM_ATTR on_color_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *e, void *ctx) {
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(band_free, &woken);
+    return woken == pdTRUE;
+}
+
+// Render scene inside r and send it, in chunks of as many rows as fit a band buffer
+static void render_rect(esp_lcd_panel_handle_t p, Rect r, void (*scene)(Target *)) {
+    int rows = W*BAND_H/(r.x2-r.x1);
+    for(int y=r.y1; y<r.y2; y+=rows) {
+        // Transfers finish in order, so a free count means the next buffer in rotation is no longer in flight
+        xSemaphoreTake(band_free, portMAX_DELAY);
+        Target t={band_buf[band_next++ % band_depth], r.x2-r.x1, r.x1, y, r.x2, (y+rows<r.y2)?y+rows:r.y2, NULL};
+        scene(&t);
+        esp_lcd_panel_draw_bitmap(p, t.x1, t.y1, t.x2, t.y2, t.px);
+    }
+}
+
+// Wait until every chunk is on the panel
+static void render_sync(void) {
+    for(int i=0; i<band_depth; i++) xSemaphoreTake(band_free, portMAX_DELAY);
+    for(int i=0; i<band_depth; i++) xSemaphoreGive(band_free);
+}
+
+// Render scene into every band and send it; returns once the last band is on the panel
+static void render_frame(esp_lcd_panel_handle_t p, void (*scene)(Target *)) {
+    render_rect(p, (Rect){0, 0, W, H}, scene);
+    render_sync();
+}
+
+// The framebuffer clipped to r
+static Target fb_target(Rect r) {
+    return (Target){fb+r.y1*W+r.x1, W, r.x1, r.y1, r.x2, r.y2, fb_rows};
+}
+
+// Send the framebuffer rows drawn since the last present, or all of them, and return how many went out.
+// Each run of rows is copied into a band buffer first, so DMA only ever reads internal SRAM and the
+// next chunk is copied while the one before it is on the bus.
+static int present(esp_lcd_panel_handle_t p, bool all) {
+    int sent = 0;
+    for(int y=0; y<H; ) {
+        if(!all && !fb_rows[y]) { y++; continue; }
+        int e = y+1;
+        while(e<H && e-y<BAND_H && (all || fb_rows[e])) e++;
+        xSemaphoreTake(band_free, portMAX_DELAY);
+        uint16_t *b = band_buf[band_next++ % band_depth];
+        memcpy(b, fb+y*W, (e-y)*W*2);
+        esp_lcd_panel_draw_bitmap(p, 0, y, W, e, b);
+        sent += e-y;
+        y = e;
+    }
+    memset(fb_rows, 0, H);
+    render_sync();
+    return sent;
+}
+
+static int area(Rect r) {
+    return (r.x2-r.x1)*(r.y2-r.y1);
+}
+
+static Rect rect_union(Rect a, Rect b) {
+    return (Rect){(a.x1<b.x1)?a.x1:b.x1, (a.y1<b.y1)?a.y1:b.y1, (a.x2>b.x2)?a.x2:b.x2, (a.y2>b.y2)?a.y2:b.y2};
+}
+
+// Add r to the dirty rects, clipped to the screen. It absorbs every rect it can merge with cheaply; when
+// the list is full it goes into the rect it grows least.
+static void add_dirty(Rect r) {
+    if(r.x1<0)r.x1=0;
+    if(r.y1<0)r.y1=0;
+    if(r.x2>W)r.x2=W;
+    if(r.y2>H)r.y2=H;
+    if(r.x1>=r.x2||r.y1>=r.y2)return;
+    for(int i=0; i<n_dirty; i++) {
+        Rect u = rect_union(dirty[i], r);
+        if(area(u) <= area(dirty[i]) + area(r) + DIRTY_SLACK) {
+            r = u;
+            dirty[i] = dirty[--n_dirty];
+            i = -1;  // The grown rect may now merge with rects already passed
+        }
+    }
+    if(n_dirty < MAX_DIRTY) {
+        dirty[n_dirty++] = r;
+        return;
+    }
+    int best = 0, growth = 0x7FFFFFFF;
+    for(int i=0; i<n_dirty; i++) {
+        int g = area(rect_union(dirty[i], r)) - area(dirty[i]);
+        if(g < growth) { growth = g; best = i; }
+    }
+    dirty[best] = rect_union(dirty[best], r);
 }
 
-static void rect(esp_lcd_panel_handle_t p, int x1, int y1, int x2, int y2, uint16_t c) {
-    for(int y=y1; y<=y2; y++)
-        for(int x=x1; x<=x2; x++)
-            if(x>=0&&x<W&&y>=0&&y<H)
-                esp_lcd_panel_draw_bitmap(p,x,y,x+1,y+1,&c);
+// Fill x1..x2-1, y1..y2-1 with c
+static void fill(Target *t, int x1, int y1, int x2, int y2, uint16_t c) {
+    if(x1<t->x1)x1=t->x1;
+    if(y1<t->y1)y1=t->y1;
+    if(x2>t->x2)x2=t->x2;
+    if(y2>t->y2)y2=t->y2;
+    if(x1>=x2||y1>=y2)return;
+    if(t->rows)memset(t->rows+y1,1,y2-y1);
+    for(int y=y1;y<y2;y++) span(t->px+(y-t->y1)*t->stride+(x1-t->x1),x2-x1,c);
 }
 
-static void tri(esp_lcd_panel_handle_t p, int x1, int y1, int x2, int y2, int x3, int y3, uint16_t c) {
-    if(y1>y2){int t=y1;y1=y2;y2=t;t=x1;x1=x2;x2=t;}
-    if(y1>y3){int t=y1;y1=y3;y3=t;t=x1;x1=x3;x3=t;}
-    if(y2>y3){int t=y2;y2=y3;y3=t;t=x2;x2=x3;x3=t;}
-    for(int y=y1;y<=y3;y++){
-        if(y<0||y>=H)continue;
-        float xa=(y3!=y1)?x1+(float)(y-y1)*(x3-x1)/(y3-y1):x1;
-        float xb=(y<y2)?((y2!=y1)?x1+(float)(y-y1)*(x2-x1)/(y2-y1):x1):((y3!=y2)?x2+(float)(y-y2)*(x3-x2)/(y3-y2):x2);
-        int xs=(xa<xb)?xa:xb, xe=(xa>xb)?xa:xb;
-        for(int x=xs;x<=xe;x++)if(x>=0&&x<W)esp_lcd_panel_draw_bitmap(p,x,y,x+1,y+1,&c);
+static void circ(Target *t, int cx, int cy, int r, uint16_t c) {
+    int dy1=(cy-r<t->y1)?t->y1-cy:-r, dy2=(cy+r>=t->y2)?t->y2-1-cy:r;
+    for(int dy=dy1; dy<=dy2; dy++) {
+        int d=r*r-dy*dy, dx=(int)sqrtf(d);
+        while(dx*dx>d)dx--;
+        while((dx+1)*(dx+1)<=d)dx++;
+        fill(t,cx-dx,cy+dy,cx+dx+1,cy+dy+1,c);
     }
 }
 
+static void rect(Target *t, int x1, int y1, int x2, int y2, uint16_t c) {
+    fill(t,x1,y1,x2+1,y2+1,c);
+}
+
+// Triangle through the centers of three pixels
+static void tri(Target *t, int x1, int y1, int x2, int y2, int x3, int y3, uint16_t c) {
+    tri_fx(t, x1*ONE+HALF, y1*ONE+HALF, x2*ONE+HALF, y2*ONE+HALF, x3*ONE+HALF, y3*ONE+HALF, c);
+}
+
 // Initialize snowflakes
 static void init_snow(void) {
     for(int i=0; i<MAX_SNOW; i++) {
@@ -91,100 +215,478 @@ static void init_snow(void) {
     }
 }
 
-// Update and draw snow
-static void update_snow(esp_lcd_panel_handle_t p) {
+// Box of the pixels circ() lights for a flake
+static Rect snow_box(const Snowflake *f) {
+    int cx = f->x, cy = f->y, r = f->size;
+    return (Rect){cx-r, cy-r, cx+r+1, cy+r+1};
+}
+
+// Move the snow and mark where each flake was and is now
+static void update_snow(void) {
     for(int i=0; i<MAX_SNOW; i++) {
+        Rect old = snow_box(&snow[i]);
         snow[i].y += snow[i].speed;
         if(snow[i].y > H) {
             snow[i].y = 0;
             snow[i].x = esp_random() % W;
         }
-        circ(p, snow[i].x, snow[i].y, snow[i].size, WHITE);
+        Rect now = snow_box(&snow[i]);
+        // A falling flake overlaps its old box; one that wrapped to the top needs two rects
+        if(now.y1 <= old.y2 && now.x1 == old.x1) {
+            add_dirty(rect_union(old, now));
+        } else {
+            add_dirty(old);
+            add_dirty(now);
+        }
+    }
+}
+
+static void draw_snow(Target *t) {
+    for(int i=0; i<MAX_SNOW; i++) {
+        // Cheap reject, most flakes miss a dirty rect
+        Rect b = snow_box(&snow[i]);
+        if(b.x2 <= t->x1 || b.x1 >= t->x2 || b.y2 <= t->y1 || b.y1 >= t->y2) continue;
+        circ(t, snow[i].x, snow[i].y, snow[i].size, WHITE);
     }
 }
 
 // Draw Christmas tree
-static void draw_tree(esp_lcd_panel_handle_t p, int cx, int by, bool lights_on) {
+static void draw_tree(Target *t, int cx, int by, bool lights_on) {
     // Star
-    circ(p, cx, by-90, 5, GOLD);
+    circ(t, cx, by-90, 5, GOLD);
     
     // Tree layers (use bright GREEN for visibility)
-    tri(p, cx-30, by-70, cx, by-90, cx+30, by-70, GREEN);
-    tri(p, cx-35, by-50, cx, by-75, cx+35, by-50, GREEN);
-    tri(p, cx-40, by-30, cx, by-60, cx+40, by-30, GREEN);
-    tri(p, cx-45, by-10, cx, by-45, cx+45, by-10, GREEN);
+    tri(t, cx-30, by-70, cx, by-90, cx+30, by-70, GREEN);
+    tri(t, cx-35, by-50, cx, by-75, cx+35, by-50, GREEN);
+    tri(t, cx-40, by-30, cx, by-60, cx+40, by-30, GREEN);
+    tri(t, cx-45, by-10, cx, by-45, cx+45, by-10, GREEN);
     
     // Trunk
-    rect(p, cx-8, by-10, cx+8, by, BROWN);
+    rect(t, cx-8, by-10, cx+8, by, BROWN);
     
     // Lights (if on)
     if(lights_on) {
         uint16_t colors[] = {RED, YELLOW, BLUE, MAGENTA, CYAN};
-        circ(p, cx-20, by-65, 3, colors[0]);
-        circ(p, cx+15, by-68, 3, colors[1]);
-        circ(p, cx-25, by-45, 3, colors[2]);
-        circ(p, cx+20, by-50, 3, colors[3]);
-        circ(p, cx-30, by-25, 3, colors[4]);
-        circ(p, cx+25, by-30, 3, colors[0]);
-        circ(p, cx-35, by-12, 3, colors[1]);
-        circ(p, cx+30, by-15, 3, colors[2]);
-    }
-}
-
-// Glyph indices order reference:
-// 0:А 1:В 2:Г 3:І 4:Е 5:Ї 6:Є 7:К 8:Л 9:М 10:Н 11:О 12:Р 13:С 14:Т 15:У 16:Х 17:Ю 18:Я 19:Б 20:space 21:Ь 22:И 23:П 24:Д 25:Й 26:З 27:Ч 28:comma 29:apostrophe 30:!
-static void draw_glyph(esp_lcd_panel_handle_t p, int x, int y, uint8_t glyph, uint16_t color) {
-    static const uint8_t font[][5] = {
-        {0x7E,0x11,0x11,0x11,0x7E}, // А
-        {0x7F,0x49,0x49,0x49,0x36}, // В
-        {0x7F,0x01,0x01,0x01,0x01}, // Г
-        {0x7F,0x10,0x10,0x10,0x7F}, // І
-        {0x7F,0x49,0x49,0x49,0x41}, // Е
-        {0x00,0x65,0x7F,0x65,0x00}, // Ї
-        {0x7F,0x49,0x7F,0x49,0x7F}, // Є (approx)
-        {0x7F,0x08,0x14,0x22,0x41}, // К
-        {0x7F,0x40,0x40,0x40,0x40}, // Л
-        {0x7F,0x02,0x0C,0x02,0x7F}, // М
-        {0x7F,0x04,0x08,0x10,0x7F}, // Н
-        {0x3E,0x41,0x41,0x41,0x3E}, // О
-        {0x7F,0x09,0x09,0x09,0x06}, // Р
-        {0x46,0x49,0x49,0x49,0x31}, // С
-        {0x01,0x01,0x7F,0x01,0x01}, // Т
-        {0x3F,0x40,0x40,0x40,0x3F}, // У
-        {0x63,0x14,0x08,0x14,0x63}, // Х
-        {0x7F,0x40,0x7C,0x40,0x7F}, // Ю
-        {0x7C,0x0A,0x09,0x0A,0x7C}, // Я
-        {0x7F,0x48,0x48,0x48,0x30}, // Б
-        {0x00,0x00,0x00,0x00,0x00}, // space
-        {0x7F,0x49,0x49,0x49,0x36}, // Ь
-        {0x41,0x22,0x7F,0x22,0x41}, // И
-        {0x41,0x41,0x7F,0x41,0x41}, // П
-        {0x7F,0x10,0x08,0x04,0x7F}, // Д
-        {0x63,0x55,0x49,0x41,0x41}, // Й
-        {0x61,0x51,0x49,0x45,0x43}, // З
-        {0x46,0x49,0x49,0x29,0x1E}, // Ч
-        {0x00,0x00,0x06,0x06,0x00}, // , (comma)
-        {0x00,0x00,0x08,0x00,0x00}, // ' (apostrophe)
-        {0x00,0x00,0x5F,0x00,0x00}, // !
-    };
-    if(glyph >= sizeof(font)/sizeof(font[0])) return;
-    for(int i=0; i<5; i++) {
-        for(int j=0; j<8; j++) {
-            if(font[glyph][i] & (1<<j)) {
-                esp_lcd_panel_draw_bitmap(p, x+i, y+j, x+i+1, y+j+1, &color);
+        circ(t, cx-20, by-65, 3, colors[0]);
+        circ(t, cx+15, by-68, 3, colors[1]);
+        circ(t, cx-25, by-45, 3, colors[2]);
+        circ(t, cx+20, by-50, 3, colors[3]);
+        circ(t, cx-30, by-25, 3, colors[4]);
+        circ(t, cx+25, by-30, 3, colors[0]);
+        circ(t, cx-35, by-12, 3, colors[1]);
+        circ(t, cx+30, by-15, 3, colors[2]);
+    }
+}
+
+// 5x7 font, a byte per column with the top row in bit 0: printable ASCII, then the Ukrainian letters
+// that have no Latin twin. Cyrillic letters shaped like Latin ones use the Latin glyph.
+static const uint8_t font[][5] = {
+    {0x00,0x00,0x00,0x00,0x00}, // space
+    {0x00,0x00,0x5F,0x00,0x00}, // !
+    {0x00,0x07,0x00,0x07,0x00}, // "
+    {0x14,0x7F,0x14,0x7F,0x14}, // #
+    {0x24,0x2A,0x7F,0x2A,0x12}, // $
+    {0x23,0x13,0x08,0x64,0x62}, // %
+    {0x36,0x49,0x55,0x22,0x50}, // &
+    {0x00,0x05,0x03,0x00,0x00}, // "'"
+    {0x00,0x1C,0x22,0x41,0x00}, // (
+    {0x00,0x41,0x22,0x1C,0x00}, // )
+    {0x14,0x08,0x3E,0x08,0x14}, // *
+    {0x08,0x08,0x3E,0x08,0x08}, // +
+    {0x00,0x50,0x30,0x00,0x00}, // ,
+    {0x08,0x08,0x08,0x08,0x08}, // -
+    {0x00,0x60,0x60,0x00,0x00}, // .
+    {0x20,0x10,0x08,0x04,0x02}, // /
+    {0x3E,0x51,0x49,0x45,0x3E}, // 0
+    {0x00,0x42,0x7F,0x40,0x00}, // 1
+    {0x42,0x61,0x51,0x49,0x46}, // 2
+    {0x21,0x41,0x45,0x4B,0x31}, // 3
+    {0x18,0x14,0x12,0x7F,0x10}, // 4
+    {0x27,0x45,0x45,0x45,0x39}, // 5
+    {0x3C,0x4A,0x49,0x49,0x30}, // 6
+    {0x01,0x71,0x09,0x05,0x03}, // 7
+    {0x36,0x49,0x49,0x49,0x36}, // 8
+    {0x06,0x49,0x49,0x29,0x1E}, // 9
+    {0x00,0x36,0x36,0x00,0x00}, // :
+    {0x00,0x56,0x36,0x00,0x00}, // ;
+    {0x08,0x14,0x22,0x41,0x00}, // <
+    {0x14,0x14,0x14,0x14,0x14}, // =
+    {0x00,0x41,0x22,0x14,0x08}, // >
+    {0x02,0x01,0x51,0x09,0x06}, // ?
+    {0x32,0x49,0x79,0x41,0x3E}, // @
+    {0x7E,0x11,0x11,0x11,0x7E}, // A
+    {0x7F,0x49,0x49,0x49,0x36}, // B
+    {0x3E,0x41,0x41,0x41,0x22}, // C
+    {0x7F,0x41,0x41,0x22,0x1C}, // D
+    {0x7F,0x49,0x49,0x49,0x41}, // E
+    {0x7F,0x09,0x09,0x01,0x01}, // F
+    {0x3E,0x41,0x49,0x49,0x7A}, // G
+    {0x7F,0x08,0x08,0x08,0x7F}, // H
+    {0x00,0x41,0x7F,0x41,0x00}, // I
+    {0x20,0x40,0x41,0x3F,0x01}, // J
+    {0x7F,0x08,0x14,0x22,0x41}, // K
+    {0x7F,0x40,0x40,0x40,0x40}, // L
+    {0x7F,0x02,0x0C,0x02,0x7F}, // M
+    {0x7F,0x04,0x08,0x10,0x7F}, // N
+    {0x3E,0x41,0x41,0x41,0x3E}, // O
+    {0x7F,0x09,0x09,0x09,0x06}, // P
+    {0x3E,0x41,0x51,0x21,0x5E}, // Q
+    {0x7F,0x09,0x19,0x29,0x46}, // R
+    {0x46,0x49,0x49,0x49,0x31}, // S
+    {0x01,0x01,0x7F,0x01,0x01}, // T
+    {0x3F,0x40,0x40,0x40,0x3F}, // U
+    {0x1F,0x20,0x40,0x20,0x1F}, // V
+    {0x7F,0x20,0x18,0x20,0x7F}, // W
+    {0x63,0x14,0x08,0x14,0x63}, // X
+    {0x03,0x04,0x78,0x04,0x03}, // Y
+    {0x61,0x51,0x49,0x45,0x43}, // Z
+    {0x00,0x7F,0x41,0x41,0x00}, // [
+    {0x02,0x04,0x08,0x10,0x20}, // '\\'
+    {0x00,0x41,0x41,0x7F,0x00}, // ]
+    {0x04,0x02,0x01,0x02,0x04}, // ^
+    {0x40,0x40,0x40,0x40,0x40}, // _
+    {0x00,0x01,0x02,0x04,0x00}, // `
+    {0x20,0x54,0x54,0x54,0x78}, // a
+    {0x7F,0x48,0x44,0x44,0x38}, // b
+    {0x38,0x44,0x44,0x44,0x20}, // c
+    {0x38,0x44,0x44,0x48,0x7F}, // d
+    {0x38,0x54,0x54,0x54,0x18}, // e
+    {0x08,0x7E,0x09,0x01,0x02}, // f
+    {0x0C,0x52,0x52,0x52,0x3E}, // g
+    {0x7F,0x08,0x04,0x04,0x78}, // h
+    {0x00,0x44,0x7D,0x40,0x00}, // i
+    {0x20,0x40,0x44,0x3D,0x00}, // j
+    {0x7F,0x10,0x28,0x44,0x00}, // k
+    {0x00,0x41,0x7F,0x40,0x00}, // l
+    {0x7C,0x04,0x18,0x04,0x78}, // m
+    {0x7C,0x08,0x04,0x04,0x78}, // n
+    {0x38,0x44,0x44,0x44,0x38}, // o
+    {0x7C,0x14,0x14,0x14,0x08}, // p
+    {0x08,0x14,0x14,0x18,0x7C}, // q
+    {0x7C,0x08,0x04,0x04,0x08}, // r
+    {0x48,0x54,0x54,0x54,0x20}, // s
+    {0x04,0x3F,0x44,0x40,0x20}, // t
+    {0x3C,0x40,0x40,0x20,0x7C}, // u
+    {0x1C,0x20,0x40,0x20,0x1C}, // v
+    {0x3C,0x40,0x30,0x40,0x3C}, // w
+    {0x44,0x28,0x10,0x28,0x44}, // x
+    {0x0C,0x50,0x50,0x50,0x3C}, // y
+    {0x44,0x64,0x54,0x4C,0x44}, // z
+    {0x00,0x08,0x36,0x41,0x00}, // {
+    {0x00,0x00,0x7F,0x00,0x00}, // |
+    {0x00,0x41,0x36,0x08,0x00}, // }
+    {0x08,0x04,0x08,0x10,0x08}, // ~
+    {0x7F,0x49,0x49,0x49,0x31}, // Б
+    {0x7F,0x01,0x01,0x01,0x01}, // Г
+    {0x7E,0x02,0x02,0x02,0x03}, // Ґ
+    {0x60,0x3F,0x21,0x3F,0x60}, // Д
+    {0x3E,0x49,0x49,0x49,0x22}, // Є
+    {0x63,0x14,0x7F,0x14,0x63}, // Ж
+    {0x22,0x41,0x49,0x49,0x36}, // З
+    {0x7F,0x10,0x08,0x04,0x7F}, // И
+    {0x00,0x45,0x7C,0x45,0x00}, // Ї
+    {0x7C,0x21,0x12,0x09,0x7C}, // Й
+    {0x40,0x3E,0x01,0x01,0x7F}, // Л
+    {0x7F,0x01,0x01,0x01,0x7F}, // П
+    {0x27,0x48,0x48,0x48,0x3F}, // У
+    {0x0C,0x12,0x7F,0x12,0x0C}, // Ф
+    {0x3F,0x20,0x20,0x3F,0x60}, // Ц
+    {0x07,0x08,0x08,0x08,0x7F}, // Ч
+    {0x7F,0x40,0x7F,0x40,0x7F}, // Ш
+    {0x3F,0x20,0x3F,0x20,0x7F}, // Щ
+    {0x7F,0x48,0x48,0x48,0x30}, // Ь
+    {0x7F,0x08,0x3E,0x41,0x3E}, // Ю
+    {0x46,0x29,0x19,0x09,0x7F}, // Я
+    {0x3C,0x4A,0x49,0x49,0x30}, // б
+    {0x7C,0x54,0x54,0x54,0x28}, // в
+    {0x7C,0x04,0x04,0x04,0x04}, // г
+    {0x7C,0x04,0x04,0x04,0x06}, // ґ
+    {0x60,0x3C,0x24,0x3C,0x60}, // д
+    {0x38,0x54,0x54,0x44,0x00}, // є
+    {0x44,0x28,0x7C,0x28,0x44}, // ж
+    {0x44,0x54,0x54,0x54,0x28}, // з
+    {0x7C,0x20,0x10,0x08,0x7C}, // и
+    {0x00,0x45,0x7C,0x41,0x00}, // ї
+    {0x7C,0x10,0x28,0x44,0x00}, // к
+    {0x40,0x38,0x04,0x04,0x7C}, // л
+    {0x7C,0x08,0x10,0x08,0x7C}, // м
+    {0x7C,0x10,0x10,0x10,0x7C}, // н
+    {0x7C,0x04,0x04,0x04,0x7C}, // п
+    {0x04,0x04,0x7C,0x04,0x04}, // т
+    {0x18,0x24,0x7F,0x24,0x18}, // ф
+    {0x3C,0x20,0x20,0x3C,0x60}, // ц
+    {0x0C,0x10,0x10,0x10,0x7C}, // ч
+    {0x7C,0x40,0x7C,0x40,0x7C}, // ш
+    {0x3C,0x20,0x3C,0x20,0x7C}, // щ
+    {0x7C,0x50,0x50,0x50,0x20}, // ь
+    {0x7C,0x10,0x38,0x44,0x38}, // ю
+    {0x48,0x34,0x14,0x14,0x7C}, // я
+    {0x7C,0x21,0x11,0x09,0x7C}, // й
+};
+
+#define GLYPH_GHE_UP 97        // Ґ, outside the U+0400 block
+#define GLYPH_GHE_UP_SMALL 119 // ґ
+#define GLYPH_UNKNOWN ('?'-0x20)
+
+// Glyph of each code point U+0400..U+045F, 0 where the font has none
+static const uint8_t cyr_index[0x60] = {
+      0,   0,   0,   0,  99,   0,  41, 103,   0,   0,   0,   0,   0,   0,   0,   0,
+     33,  95,  34,  96,  98,  37, 100, 101, 102, 104,  43, 105,  45,  40,  47, 106,
+     48,  35,  52, 107, 108,  56, 109, 110, 111, 112,   0,   0, 113,   0, 114, 115,
+     65, 116, 117, 118, 120,  69, 122, 123, 124, 140, 126, 127, 128, 129,  79, 130,
+     80,  67, 131,  89, 132,  88, 133, 134, 135, 136,   0,   0, 137,   0, 138, 139,
+      0,   0,   0,   0, 121,   0,  73, 125,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+// Glyph of code point c; anything the font lacks shows as '?'
+static int glyph_of(uint32_t c) {
+    if(c>=0x20 && c<0x7F) return c-0x20;
+    if(c>=0x400 && c<0x460 && cyr_index[c-0x400]) return cyr_index[c-0x400];
+    if(c==0x490) return GLYPH_GHE_UP;
+    if(c==0x491) return GLYPH_GHE_UP_SMALL;
+    if(c==0x2BC || c==0x2019) return '\''-0x20;  // Ukrainian apostrophe and right single quote
+    return GLYPH_UNKNOWN;
+}
+
+// Decode the code point at *s and move past it. A malformed or cut sequence decodes as '?' and never
+// steps over the terminating NUL.
+static uint32_t utf8_next(const char **s) {
+    const uint8_t *p = (const uint8_t *)*s;
+    uint32_t c = *p++;
+    int n = (c>=0xF0)?3:(c>=0xE0)?2:(c>=0xC0)?1:(c>=0x80)?-1:0;
+    if(n > 0) {
+        c &= 0x3F>>n;
+        for(int i=0; i<n; i++, p++) {
+            if((*p&0xC0) != 0x80) { n = -1; break; }
+            c = c<<6 | (*p&0x3F);
+        }
+    }
+    *s = (const char *)p;
+    return (n<0) ? '?' : c;
+}
+
+// Glyph cell at scale 1: 5 columns and a gap, 7 rows and a gap
+#define CELL_W 6
+#define CELL_H 8
+
+// Size of the box text() fills for s at scale
+static Rect text_box(int x, int y, const char *s, int scale) {
+    int n = 0;
+    while(*s) { utf8_next(&s); n++; }
+    return (Rect){x, y, x+n*CELL_W*scale, y+CELL_H*scale};
+}
+
+// Draw UTF-8 text s with its top left corner at x,y, each font pixel scale x scale. bg fills the whole
+// box first; -1 leaves what is under the text.
+static void text(Target *t, int x, int y, const char *s, uint16_t fg, int bg, int scale) {
+    if(y >= t->y2 || y+CELL_H*scale <= t->y1) return;
+    if(bg >= 0) {
+        Rect b = text_box(x, y, s, scale);
+        fill(t, b.x1, b.y1, b.x2, b.y2, bg);
+    }
+    for(; *s && x < t->x2; x += CELL_W*scale) {
+        const uint8_t *g = font[glyph_of(utf8_next(&s))];
+        if(x+5*scale <= t->x1) continue;
+        // One span per run of lit pixels in a glyph row
+        for(int j=0; j<7; j++) {
+            for(int i=0; i<5; i++) {
+                if(!(g[i] & (1<<j))) continue;
+                int e=i+1;
+                while(e<5 && (g[e] & (1<<j))) e++;
+                fill(t, x+i*scale, y+j*scale, x+e*scale, y+(j+1)*scale, fg);
+                i=e;
             }
         }
     }
 }
 
-static void draw_glyphs(esp_lcd_panel_handle_t p, int x, int y, const uint8_t *glyphs, int len, uint16_t color) {
-    int cx = x;
-    for(int i=0;i<len;i++) {
-        draw_glyph(p, cx, y, glyphs[i], color);
-        cx += 6;
+// Text box for draw_text(); render_rect() scenes take no arguments
+static struct {
+    int x, y, scale, bg;
+    const char *s;
+    uint16_t fg;
+} text_job;
+
+static void draw_text_job(Target *t) {
+    text(t, text_job.x, text_job.y, text_job.s, text_job.fg, text_job.bg, text_job.scale);
+}
+
+// Render the box of s into a band buffer and send it straight to the panel: one transfer whenever the
+// box fits W*BAND_H pixels
+static void draw_text(esp_lcd_panel_handle_t p, int x, int y, const char *s, uint16_t fg, uint16_t bg, int scale) {
+    Rect b = text_box(x, y, s, scale);
+    if(b.x1<0)b.x1=0;
+    if(b.y1<0)b.y1=0;
+    if(b.x2>W)b.x2=W;
+    if(b.y2>H)b.y2=H;
+    if(b.x1>=b.x2||b.y1>=b.y2)return;
+    text_job.x = x;
+    text_job.y = y;
+    text_job.s = s;
+    text_job.fg = fg;
+    text_job.bg = bg;
+    text_job.scale = scale;
+    render_rect(p, b, draw_text_job);
+    render_sync();
+}
+
+#define GREETING "З Новим роком 2026!"
+#define STATUS_X 4
+#define STATUS_Y (H-12)
+static char status[32];  // Frame rate line on the ground
+
+// Night sky with the greeting, snowy ground and the tree with its lights
+static void draw_scene(Target *t) {
+    fill(t, 0, 0, W, H-30, DARK_BLUE);
+    fill(t, 0, H-30, W, H, WHITE);
+    text(t, (W-text_box(0, 0, GREETING, 2).x2)/2, 24, GREETING, GOLD, -1, 2);
+    draw_tree(t, W/2, H-30, true);
+    text(t, STATUS_X, STATUS_Y, status, BLACK, -1, 1);
+}
+
+// The scene with the snow over it
+static void draw_frame(Target *t) {
+    draw_scene(t);
+    draw_snow(t);
+}
+
+// Advance the snow one frame and redraw what it touched, as dirty rects through the band buffers or
+// into the framebuffer followed by a present of its dirty rows. Returns the pixels sent and adds the
+// number of dirty rects to *rects.
+static int snow_step(esp_lcd_panel_handle_t p, bool in_fb, int *rects) {
+    int px = 0;
+    update_snow();
+    *rects += n_dirty;
+    for(int i=0; i<n_dirty; i++) {
+        if(in_fb) {
+            Target t = fb_target(dirty[i]);
+            draw_frame(&t);
+        } else {
+            render_rect(p, dirty[i], draw_frame);
+            px += area(dirty[i]);
+        }
+    }
+    n_dirty = 0;
+    if(in_fb) return present(p, false)*W;
+    render_sync();
+    return px;
+}
+
+// Baseline: render scene a band at a time, then send it one draw_bitmap per pixel, like the primitives
+// before the spans. Every pixel takes a band_free count that its transfer gives back.
+static void render_per_pixel(esp_lcd_panel_handle_t p, void (*scene)(Target *)) {
+    for(int y=0; y<H; y+=BAND_H) {
+        Target t={band_buf[0], W, 0, y, W, (y+BAND_H<H)?y+BAND_H:H, NULL};
+        scene(&t);
+        for(int py=t.y1; py<t.y2; py++)
+            for(int px=0; px<W; px++) {
+                xSemaphoreTake(band_free, portMAX_DELAY);
+                esp_lcd_panel_draw_bitmap(p, px, py, px+1, py+1, t.px+(py-t.y1)*W+px);
+            }
+        // The next band reuses the buffer
+        render_sync();
     }
 }
 
+// Frame rate of the band pipeline with rendering and SPI serialized and overlapped, against one frame
+// sent per pixel. SPI utilization is the share of the frame time the bus needs for the frame's pixels
+// at LCD_CLK.
+static void bench_bands(esp_lcd_panel_handle_t p) {
+    const int frames = 20;
+    const int64_t wire_us = (int64_t)W*H*16*1000000/LCD_CLK;
+    int64_t t = esp_timer_get_time();
+    render_per_pixel(p, draw_scene);
+    int64_t pixel_us = esp_timer_get_time() - t;
+    ESP_LOGI(TAG, "Per pixel: %lld us/frame, %.1f fps", (long long)pixel_us, 1e6 / pixel_us);
+    for(int depth=1; depth<=2; depth++) {
+        // Serialized runs hold one buffer back, so only one band is ever in flight
+        band_depth = depth;
+        if(depth == 1) xSemaphoreTake(band_free, portMAX_DELAY);
+        t = esp_timer_get_time();
+        for(int i=0; i<frames; i++) render_frame(p, draw_scene);
+        int64_t frame_us = (esp_timer_get_time() - t) / frames;
+        if(depth == 1) xSemaphoreGive(band_free);
+        ESP_LOGI(TAG, "%s: %lld us/frame, %.1f fps, SPI %d%% busy, %.1fx per pixel", (depth == 1) ? "Serialized" : "Ping-pong",
+                 (long long)frame_us, 1e6 / frame_us, (int)(100 * wire_us / frame_us), (double)pixel_us / frame_us);
+    }
+}
+
+// Full frames drawn into the PSRAM framebuffer and presented, split into drawing and present time, then
+// snow frames in both modes with the pixels each one sends
+static void bench_fb(esp_lcd_panel_handle_t p) {
+    const int frames = 20;
+    if(!fb) {
+        ESP_LOGW(TAG, "No PSRAM framebuffer, only the band mode runs");
+        return;
+    }
+    int64_t draw_us = 0, present_us = 0;
+    for(int i=0; i<frames; i++) {
+        int64_t t = esp_timer_get_time();
+        Target ft = fb_target((Rect){0, 0, W, H});
+        draw_scene(&ft);
+        int64_t t2 = esp_timer_get_time();
+        present(p, true);
+        draw_us += t2 - t;
+        present_us += esp_timer_get_time() - t2;
+    }
+    ESP_LOGI(TAG, "PSRAM: %lld us/frame (%lld draw, %lld present), %.1f fps", (long long)((draw_us + present_us) / frames),
+             (long long)(draw_us / frames), (long long)(present_us / frames), 1e6 * frames / (draw_us + present_us));
+
+    for(int in_fb=0; in_fb<=1; in_fb++) {
+        // Both modes start from the same snow on a complete screen
+        init_snow();
+        if(in_fb) {
+            Target ft = fb_target((Rect){0, 0, W, H});
+            draw_frame(&ft);
+            present(p, true);
+        } else {
+            render_frame(p, draw_frame);
+        }
+        int rects = 0;
+        int64_t px = 0, t = esp_timer_get_time();
+        for(int i=0; i<frames; i++) px += snow_step(p, in_fb, &rects);
+        int64_t frame_us = (esp_timer_get_time() - t) / frames;
+        ESP_LOGI(TAG, "%s snow: %lld us/frame, %lld px/frame", in_fb ? "PSRAM dirty rows" : "SRAM dirty rects",
+                 (long long)frame_us, (long long)(px / frames));
+    }
+}
+
+// Random fixed-point coordinate in lo..hi-1 pixels, fraction included
+static int rand_fx(int lo, int hi) {
+    return lo*ONE + (int)(esp_random() % ((hi-lo)*ONE));
+}
+
+// Triangles per second for small and large triangles, with the rasterizer and the per-pixel reference
+static void bench_tri(void) {
+    enum { n = 64, size = 128 };
+    uint16_t *buf = malloc(size*size*2);
+    static int v[n][6];
+    Target t = {buf, size, 0, 0, size, size, NULL};
+    for(int big=0; big<=1; big++) {
+        // Small triangles fit a 16 px box somewhere in the target, large ones span all of it
+        for(int i=0; i<n; i++) {
+            int x = big ? 0 : esp_random()%(size-16), y = big ? 0 : esp_random()%(size-16), w = big ? size : 16;
+            for(int k=0; k<6; k+=2) {
+                v[i][k] = rand_fx(x, x+w);
+                v[i][k+1] = rand_fx(y, y+w);
+            }
+        }
+        float rate[2];
+        for(int ref=0; ref<=1; ref++) {
+            int reps = ref ? 1 : 20;
+            int64_t t0 = esp_timer_get_time();
+            for(int r=0; r<reps; r++) {
+                for(int i=0; i<n; i++) {
+                    if(ref) tri_ref(&t, v[i][0], v[i][1], v[i][2], v[i][3], v[i][4], v[i][5], (uint16_t)i);
+                    else tri_fx(&t, v[i][0], v[i][1], v[i][2], v[i][3], v[i][4], v[i][5], (uint16_t)i);
+                }
+            }
+            rate[ref] = 1e6f*reps*n / (esp_timer_get_time() - t0);
+        }
+        ESP_LOGI(TAG, "%s triangles: %.0f/s, reference %.0f/s", big ? "Large" : "Small", rate[0], rate[1]);
+    }
+    free(buf);
+}
 
 void app_main(void) {
     ESP_LOGI(TAG,"Happy New Year 2026!");
@@ -200,7 +702,8 @@ void app_main(void) {
     
     // Initialize LCD panel IO
     esp_lcd_panel_io_handle_t io;
-    esp_lcd_panel_io_spi_config_t ioc={.dc_gpio_num=PIN_DC,.cs_gpio_num=PIN_CS,.pclk_hz=LCD_CLK,.lcd_cmd_bits=8,.lcd_param_bits=8,.spi_mode=0,.trans_queue_depth=10};
+    band_free = xSemaphoreCreateCounting(2, 2);
+    esp_lcd_panel_io_spi_config_t ioc={.dc_gpio_num=PIN_DC,.cs_gpio_num=PIN_CS,.pclk_hz=LCD_CLK,.lcd_cmd_bits=8,.lcd_param_bits=8,.spi_mode=0,.trans_queue_depth=10,.on_color_trans_done=on_color_done};
     ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_HOST,&ioc,&io));
     
     // Initialize LCD panel
@@ -218,30 +721,46 @@ void app_main(void) {
     
     ESP_LOGI(TAG,"Starting animation...");
     
-    uint16_t *buffer = heap_caps_malloc(W*2, MALLOC_CAP_DMA);
+    band_buf[0] = heap_caps_malloc(W*BAND_H*2, MALLOC_CAP_DMA);
+    band_buf[1] = heap_caps_malloc(W*BAND_H*2, MALLOC_CAP_DMA);
+    fb = heap_caps_malloc(W*H*2, MALLOC_CAP_SPIRAM);
+
+    draw_text(p, 0, 0, "Тест швидкості...", WHITE, BLACK, 2);
     
-    // Clear screen with dark blue night sky
-    for(int y=0; y<H; y++) {
-        for(int x=0; x<W; x++) buffer[x] = DARK_BLUE;
-        esp_lcd_panel_draw_bitmap(p, 0, y, W, y+1, buffer);
-    }
+    // Night sky, snow on the ground and the Christmas tree (static) with lights ON
+    bench_bands(p);
+    bench_fb(p);
+    bench_tri();
 
-    // Draw snow on ground
-    for(int y=H-30; y<H; y++) {
-        for(int x=0; x<W; x++) buffer[x] = WHITE;
-        esp_lcd_panel_draw_bitmap(p, 0, y, W, y+1, buffer);
+    // Animate the snow: only what the flakes touched is re-rendered and sent
+    bool in_fb = FB_MODE && fb;
+    if(in_fb) {
+        Target ft = fb_target((Rect){0, 0, W, H});
+        draw_frame(&ft);
+        present(p, true);
+    } else {
+        render_frame(p, draw_frame);
     }
-
-    // Draw Christmas tree (static) with lights ON
-    draw_tree(p, W/2, H-30, true);
-
- 
-
-    // Keep idle; snowflakes optional static overlay (no animation)
+    TickType_t last = xTaskGetTickCount();
+    int frames = 0, rects = 0;
+    int64_t busy_us = 0, px = 0, stats_t = esp_timer_get_time();
     while(1) {
-        vTaskDelay(pdMS_TO_TICKS(1000));
-    }
+        int64_t t = esp_timer_get_time();
+        px += snow_step(p, in_fb, &rects);
+        busy_us += esp_timer_get_time() - t;
 
-    // not reached
-    // free(buffer);
+        if(++frames == 2*FPS) {
+            int64_t now = esp_timer_get_time();
+            ESP_LOGI(TAG, "%.1f fps, %lld us/frame busy, %d rects and %lld px/frame", frames * 1e6 / (now - stats_t),
+                     (long long)(busy_us / frames), rects / frames, (long long)(px / frames));
+            // The old line may be longer than the new one
+            add_dirty(text_box(STATUS_X, STATUS_Y, status, 1));
+            snprintf(status, sizeof(status), "%.1f fps", frames * 1e6 / (now - stats_t));
+            add_dirty(text_box(STATUS_X, STATUS_Y, status, 1));
+            frames = rects = 0;
+            busy_us = px = 0;
+            stats_t = now;
+        }
+        vTaskDelayUntil(&last, pdMS_TO_TICKS(1000/FPS));
+    }
 }
@@ -0,0 +1,130 @@
+#include <string.h>
+#include <unity.h>
+#include "raster.h"
+
+// Host tests of the fixed-point triangle rasterizer against the per-pixel reference and the top-left rule
+
+#define TW 64
+#define TH 48
+#define TX 40  // The target sits at TX,TY so that clipping and negative coordinates get exercised
+#define TY 60
+
+static uint16_t a[TW*TH], b[TW*TH];
+static uint32_t seed;
+
+// Deterministic LCG, so a failure names the same triangle on every run
+static int rand_fx(int lo, int hi) {
+    seed = seed*1664525u + 1013904223u;
+    return lo*ONE + (int)((seed>>8) % (uint32_t)((hi-lo)*ONE));
+}
+
+static Target target(uint16_t *px) {
+    memset(px, 0, TW*TH*2);
+    return (Target){px, TW, TX, TY, TX+TW, TY+TH, NULL};
+}
+
+void setUp(void) {
+    seed = 2026;
+}
+
+void tearDown(void) {
+}
+
+// Walking an edge row by row lands where placing it on that row does
+static void test_edge_step(void) {
+    for(int i=0; i<500; i++) {
+        int X0 = rand_fx(-20, 80), Y0 = rand_fx(-20, 80), X1 = rand_fx(-20, 80), Y1 = Y0 + 1 + rand_fx(0, 60);
+        int y = row_of(Y0);
+        Edge walked, placed;
+        edge_init(&walked, X0, Y0, X1, Y1, y);
+        for(; y<row_of(Y1); y++, edge_step(&walked)) {
+            edge_init(&placed, X0, Y0, X1, Y1, y);
+            TEST_ASSERT_EQUAL_INT(placed.q, walked.q);
+            TEST_ASSERT_EQUAL_INT(placed.r, walked.r);
+        }
+    }
+}
+
+static void test_tri_matches_reference(void) {
+    for(int i=0; i<2000; i++) {
+        int v[6];
+        for(int k=0; k<6; k+=2) {
+            v[k] = rand_fx(TX-TW/2, TX+TW+TW/2);
+            v[k+1] = rand_fx(TY-TH/2, TY+TH+TH/2);
+        }
+        // Every fifth triangle gets its vertices on the centers of a 4 px grid, for shared rows and columns
+        // and pixels exactly on edges
+        if(i%5 == 0) for(int k=0; k<6; k++) v[k] = (v[k]&~(4*ONE-1))+HALF;
+        Target ta = target(a), tb = target(b);
+        tri_fx(&ta, v[0], v[1], v[2], v[3], v[4], v[5], 0xFFFF);
+        tri_ref(&tb, v[0], v[1], v[2], v[3], v[4], v[5], 0xFFFF);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(b, a, TW*TH, "tri_fx differs from the reference");
+    }
+}
+
+// A fan around one point covers every pixel of its outline exactly once, whatever the edges go through
+static void test_shared_edges(void) {
+    static uint8_t count[TW*TH];
+    for(int fan=0; fan<50; fan++) {
+        int cx = rand_fx(TX+16, TX+TW-16), cy = rand_fx(TY+12, TY+TH-12), n = 3 + fan%6;
+        // Fans on the pixel center grid put centers on the shared edges
+        if(fan%2) { cx = (cx&~(ONE-1))+HALF; cy = (cy&~(ONE-1))+HALF; }
+        int vx[9], vy[9];
+        for(int k=0; k<n; k++) {
+            // One vertex per sector around the center, so the fan does not fold over itself
+            static const int dir[8][2] = {{1,0},{1,1},{0,1},{-1,1},{-1,0},{-1,-1},{0,-1},{1,-1}};
+            int s = k*8/n, r = rand_fx(4, 12);
+            vx[k] = cx + dir[s][0]*r + (fan%2 ? 0 : rand_fx(0, 2)-ONE);
+            vy[k] = cy + dir[s][1]*r + (fan%2 ? 0 : rand_fx(0, 2)-ONE);
+        }
+        vx[n] = vx[0];
+        vy[n] = vy[0];
+        memset(count, 0, sizeof(count));
+        Target tb = target(b);
+        for(int k=0; k<n; k++) {
+            Target ta = target(a);
+            tri_fx(&ta, cx, cy, vx[k], vy[k], vx[k+1], vy[k+1], 1);
+            tri_ref(&tb, cx, cy, vx[k], vy[k], vx[k+1], vy[k+1], 1);
+            for(int i=0; i<TW*TH; i++) count[i] += a[i];
+        }
+        for(int i=0; i<TW*TH; i++) {
+            TEST_ASSERT_TRUE_MESSAGE(count[i] <= 1, "Pixel drawn by two triangles of a fan");
+            TEST_ASSERT_EQUAL_INT_MESSAGE(b[i], count[i], "Pixel of the fan outline missed");
+        }
+    }
+}
+
+// Two triangles splitting the 4x4 square at TX,TY along its diagonal, all vertices on pixel centers
+static void test_top_left_rule(void) {
+    int x0 = (TX)*ONE+HALF, y0 = (TY)*ONE+HALF, x4 = (TX+4)*ONE+HALF, y4 = (TY+4)*ONE+HALF;
+    Target ta = target(a);
+    // Top and left edges through pixel centers are in, the diagonal is the right edge and out
+    tri_fx(&ta, x0, y0, x4, y0, x0, y4, 1);
+    for(int y=0; y<6; y++)
+        for(int x=0; x<6; x++)
+            TEST_ASSERT_EQUAL_INT(x+y < 4, a[y*TW+x]);
+    // The diagonal is the top-left edge of the other half; its right and bottom edges are out
+    ta = target(a);
+    tri_fx(&ta, x4, y0, x4, y4, x0, y4, 1);
+    for(int y=0; y<6; y++)
+        for(int x=0; x<6; x++)
+            TEST_ASSERT_EQUAL_INT(x < 4 && y < 4 && x+y >= 4, a[y*TW+x]);
+    // A bottom edge through centers drops its row, and the apex center is on the right edge
+    ta = target(a);
+    tri_fx(&ta, x0, y0, x4, y4, x0-4*ONE, y4, 1);
+    for(int x=0; x<TW; x++) {
+        TEST_ASSERT_EQUAL_INT(0, a[x]);
+        TEST_ASSERT_EQUAL_INT(0, a[4*TW+x]);
+    }
+    TEST_ASSERT_EQUAL_INT(1, a[TW]);
+    TEST_ASSERT_EQUAL_INT(0, a[TW+1]);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_edge_step);
+    RUN_TEST(test_tri_matches_reference);
+    RUN_TEST(test_shared_edges);
+    RUN_TEST(test_top_left_rule);
+    return UNITY_END();
+}
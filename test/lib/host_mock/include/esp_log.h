@@ -0,0 +1,19 @@
+#pragma once
+
+/* Host stand-in for esp_log.h: arguments are type-checked, nothing is printed. */
+
+#include <stdio.h>
+
+#define ESP_HOST_LOG(tag, format, ...)        \
+    do                                        \
+    {                                         \
+        (void)(tag);                          \
+        if (0)                                \
+            printf(format, ##__VA_ARGS__);    \
+    } while (0)
+
+#define ESP_LOGE(tag, format, ...) ESP_HOST_LOG(tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_HOST_LOG(tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_HOST_LOG(tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ESP_HOST_LOG(tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) ESP_HOST_LOG(tag, format, ##__VA_ARGS__)
@@ -0,0 +1,19 @@
+#pragma once
+
+/* Host stand-in for the FreeRTOS kernel types; one tick is one millisecond. */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define tskNO_AFFINITY ((BaseType_t)0x7FFFFFFF)
@@ -0,0 +1,108 @@
+#pragma once
+
+/*
+ * Recording I2C bus for host tests.
+ *
+ * Every i2c_master_transmit() is recorded with its payload and a modeled bus time, and fed to a model of
+ * the SSD1306 command interface so tests can compare what reached the display RAM with the framebuffer.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define I2C_MOCK_SSD1306_PAGES 8
+#define I2C_MOCK_SSD1306_COLUMNS 128
+
+/**
+ * @brief One recorded write transaction.
+ */
+typedef struct
+{
+    uint16_t device_address;
+    uint32_t scl_speed_hz;
+    size_t size;
+    uint8_t *data;
+    uint64_t bus_time_ns;
+} i2c_mock_transaction_t;
+
+/**
+ * @brief State of the SSD1306 model behind one device address.
+ *
+ * Continuous scrolls are only recorded. One-shot content scrolls rotate the window in 'ram' by one column.
+ */
+typedef struct
+{
+    uint8_t ram[I2C_MOCK_SSD1306_PAGES][I2C_MOCK_SSD1306_COLUMNS];
+    uint8_t addressing_mode;
+    uint8_t column_start;
+    uint8_t column_end;
+    uint8_t page_start;
+    uint8_t page_end;
+    uint8_t column;
+    uint8_t page;
+    uint8_t start_line;
+    bool display_on;
+    bool scroll_active;
+    uint8_t last_scroll_cmd[8];
+    size_t last_scroll_cmd_size;
+} i2c_mock_ssd1306_t;
+
+/**
+ * @brief Forget every recorded transaction. Device models keep their state.
+ */
+void i2c_mock_reset(void);
+
+/**
+ * @brief Forget every recorded transaction and reset all device models to their power-on state.
+ */
+void i2c_mock_reset_all(void);
+
+size_t i2c_mock_transaction_count(void);
+const i2c_mock_transaction_t *i2c_mock_get_transaction(size_t index);
+
+/**
+ * @brief Bytes put on the bus since the last reset: address byte plus payload of every transaction.
+ */
+size_t i2c_mock_wire_bytes(void);
+
+/**
+ * @brief Modeled bus time since the last reset.
+ *
+ * Every byte costs 9 SCL periods (8 data bits and the acknowledge), every transaction 2 more for the
+ * start and stop conditions, at the SCL rate the device was added with.
+ */
+uint64_t i2c_mock_bus_time_ns(void);
+
+/**
+ * @brief Make the next 'count' transmissions fail with 'err' without reaching the device model.
+ */
+void i2c_mock_inject_error(esp_err_t err, uint32_t count);
+
+/**
+ * @brief Make the next 'count' calls of i2c_master_bus_add_device() fail with ESP_ERR_NO_MEM.
+ *
+ * Reset by i2c_mock_reset_all().
+ */
+void i2c_mock_fail_add_device(uint32_t count);
+
+/**
+ * @brief Make every transmission of a device added with an SCL rate above 'max_scl_hz' fail with ESP_FAIL.
+ *
+ * Models a panel that stops acknowledging above its maximum clock; 0 removes the limit. Reset by
+ * i2c_mock_reset_all().
+ */
+void i2c_mock_set_max_scl_hz(uint32_t max_scl_hz);
+
+/**
+ * @brief Make every transmission block for its modeled bus time, like a real bus would.
+ *
+ * Transmissions are serialized either way. Reset by i2c_mock_reset_all().
+ */
+void i2c_mock_set_realtime(bool realtime);
+
+/**
+ * @brief SSD1306 model of the device at 'device_address', or NULL if no such device was added.
+ */
+const i2c_mock_ssd1306_t *i2c_mock_ssd1306(uint16_t device_address);
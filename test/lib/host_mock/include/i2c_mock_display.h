@@ -0,0 +1,39 @@
+#pragma once
+
+/*
+ * SSD1306 fixtures shared by the host test suites: displays on the recording bus, a decoder for image assets and
+ * a comparison of a display's framebuffer with the modeled RAM behind it.
+ */
+
+#include "i2c_mock.h"
+#include "ssd1306.h"
+
+/**
+ * @brief Create the mock bus and initialize a 128-column display at 0x3C on it with 'height' rows.
+ *
+ * Same as i2c_mock_init_display_at(0x3C, 128, height, addressing, bus, handle).
+ */
+esp_err_t i2c_mock_init_display(uint8_t height, ssd1306_addressing_t addressing, i2c_master_bus_handle_t *bus, i2c_ssd1306_handle_t *handle);
+
+/**
+ * @brief Create the mock bus and initialize a display of any geometry at 'device_address' on it.
+ *
+ * The framebuffer is fixture storage, one per handle, so every geometry runs whatever the embedded storage of the
+ * handle. The transactions of the init sequence are forgotten, so counts start at the first flush.
+ */
+esp_err_t i2c_mock_init_display_at(uint16_t device_address, uint8_t width, uint8_t height, ssd1306_addressing_t addressing, i2c_master_bus_handle_t *bus, i2c_ssd1306_handle_t *handle);
+
+/**
+ * @brief Decode 'image' into 'strips', laid out like a framebuffer of the image's geometry without the header.
+ *
+ * Uses a temporary display at 0x3D, so the image must be a valid panel geometry: up to 128 columns and 16 to 64 rows
+ * in whole pages.
+ */
+esp_err_t i2c_mock_decode_image(const ssd1306_image_t *image, uint8_t *strips);
+
+/**
+ * @brief Offset of the first framebuffer byte of 'handle' that differs from the modeled RAM at 'device_address'.
+ *
+ * Page-major like the framebuffer; -1 when every page matches, -2 when no device was added at that address.
+ */
+int i2c_mock_ram_mismatch(const i2c_ssd1306_handle_t *handle, uint16_t device_address);
@@ -0,0 +1,8 @@
+#pragma once
+
+/* Host stand-in for the ESP-IDF NVS partition API. nvs_flash_erase() empties the in-memory table. */
+
+#include "nvs.h"
+
+esp_err_t nvs_flash_init(void);
+esp_err_t nvs_flash_erase(void);
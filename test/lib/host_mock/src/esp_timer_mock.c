@@ -0,0 +1,103 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "esp_timer.h"
+
+struct host_timer
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t stopped;
+    esp_timer_cb_t callback;
+    void *arg;
+    uint64_t period_us;
+    bool running;
+};
+
+static void *timer_entry(void *arg)
+{
+    struct host_timer *timer = (struct host_timer *)arg;
+    struct timespec next;
+    clock_gettime(CLOCK_REALTIME, &next);
+
+    pthread_mutex_lock(&timer->lock);
+    while (timer->running)
+    {
+        /* Absolute deadlines, so a slow callback does not drift the period. */
+        next.tv_sec += timer->period_us / 1000000;
+        next.tv_nsec += (long)(timer->period_us % 1000000) * 1000L;
+        if (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000L;
+        }
+        while (timer->running && pthread_cond_timedwait(&timer->stopped, &timer->lock, &next) == 0)
+            ;
+        if (!timer->running)
+            break;
+        pthread_mutex_unlock(&timer->lock);
+        timer->callback(timer->arg);
+        pthread_mutex_lock(&timer->lock);
+    }
+    pthread_mutex_unlock(&timer->lock);
+
+    return NULL;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle)
+{
+    if (create_args == NULL || create_args->callback == NULL || out_handle == NULL)
+        return ESP_ERR_INVALID_ARG;
+    struct host_timer *timer = calloc(1, sizeof(struct host_timer));
+    if (timer == NULL)
+        return ESP_ERR_NO_MEM;
+    pthread_mutex_init(&timer->lock, NULL);
+    pthread_cond_init(&timer->stopped, NULL);
+    timer->callback = create_args->callback;
+    timer->arg = create_args->arg;
+    *out_handle = timer;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    if (timer->running)
+        return ESP_ERR_INVALID_STATE;
+    timer->period_us = period;
+    timer->running = true;
+    if (pthread_create(&timer->thread, NULL, timer_entry, timer) != 0)
+    {
+        timer->running = false;
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    pthread_mutex_lock(&timer->lock);
+    if (!timer->running)
+    {
+        pthread_mutex_unlock(&timer->lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->running = false;
+    pthread_cond_signal(&timer->stopped);
+    pthread_mutex_unlock(&timer->lock);
+    pthread_join(timer->thread, NULL);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    if (timer->running)
+        return ESP_ERR_INVALID_STATE;
+    pthread_mutex_destroy(&timer->lock);
+    pthread_cond_destroy(&timer->stopped);
+    free(timer);
+
+    return ESP_OK;
+}
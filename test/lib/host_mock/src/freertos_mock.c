@@ -0,0 +1,196 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+struct host_task
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t notified;
+    uint32_t notify_count;
+    void (*task_code)(void *);
+    void *parameters;
+};
+
+struct host_semaphore
+{
+    pthread_mutex_t lock;
+    pthread_cond_t given;
+    bool available;
+};
+
+static __thread struct host_task *current_task;
+
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += ticks / 1000;
+    deadline.tv_nsec += (long)(ticks % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    return deadline;
+}
+
+static void unlock_on_cancel(void *lock)
+{
+    pthread_mutex_unlock((pthread_mutex_t *)lock);
+}
+
+static void *task_entry(void *arg)
+{
+    current_task = (struct host_task *)arg;
+    current_task->task_code(current_task->parameters);
+
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(void (*task_code)(void *), const char *name, uint32_t stack_depth, void *parameters, UBaseType_t priority, TaskHandle_t *created_task, BaseType_t core_id)
+{
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    (void)core_id;
+    struct host_task *task = calloc(1, sizeof(struct host_task));
+    if (task == NULL)
+        return pdFAIL;
+    pthread_mutex_init(&task->lock, NULL);
+    pthread_cond_init(&task->notified, NULL);
+    task->task_code = task_code;
+    task->parameters = parameters;
+    if (created_task)
+        *created_task = task;
+    if (pthread_create(&task->thread, NULL, task_entry, task) != 0)
+    {
+        free(task);
+        return pdFAIL;
+    }
+
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL || task == current_task)
+        pthread_exit(NULL);
+    pthread_cancel(task->thread);
+    pthread_join(task->thread, NULL);
+    pthread_mutex_destroy(&task->lock);
+    pthread_cond_destroy(&task->notified);
+    free(task);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec delay = {.tv_sec = ticks / 1000, .tv_nsec = (long)(ticks % 1000) * 1000000L};
+    nanosleep(&delay, NULL);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (TickType_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait)
+{
+    struct host_task *task = current_task;
+    struct timespec deadline = deadline_after(ticks_to_wait);
+    pthread_mutex_lock(&task->lock);
+    /* vTaskDelete() cancels tasks blocked here; release the lock on the way out. */
+    pthread_cleanup_push(unlock_on_cancel, &task->lock);
+    while (task->notify_count == 0)
+    {
+        int rc = (ticks_to_wait == portMAX_DELAY) ? pthread_cond_wait(&task->notified, &task->lock)
+                                                  : pthread_cond_timedwait(&task->notified, &task->lock, &deadline);
+        if (rc == ETIMEDOUT)
+            break;
+    }
+    pthread_cleanup_pop(0);
+    uint32_t count = task->notify_count;
+    if (count > 0)
+        task->notify_count = clear_count_on_exit ? 0 : count - 1;
+    pthread_mutex_unlock(&task->lock);
+
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notify_count++;
+    pthread_cond_signal(&task->notified);
+    pthread_mutex_unlock(&task->lock);
+
+    return pdPASS;
+}
+
+static SemaphoreHandle_t semaphore_create(bool available)
+{
+    struct host_semaphore *semaphore = calloc(1, sizeof(struct host_semaphore));
+    if (semaphore == NULL)
+        return NULL;
+    pthread_mutex_init(&semaphore->lock, NULL);
+    pthread_cond_init(&semaphore->given, NULL);
+    semaphore->available = available;
+
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return semaphore_create(false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return semaphore_create(true);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    struct timespec deadline = deadline_after(ticks_to_wait);
+    pthread_mutex_lock(&semaphore->lock);
+    pthread_cleanup_push(unlock_on_cancel, &semaphore->lock);
+    while (!semaphore->available && ticks_to_wait != 0)
+    {
+        int rc = (ticks_to_wait == portMAX_DELAY) ? pthread_cond_wait(&semaphore->given, &semaphore->lock)
+                                                  : pthread_cond_timedwait(&semaphore->given, &semaphore->lock, &deadline);
+        if (rc == ETIMEDOUT)
+            break;
+    }
+    pthread_cleanup_pop(0);
+    BaseType_t taken = semaphore->available ? pdTRUE : pdFALSE;
+    semaphore->available = false;
+    pthread_mutex_unlock(&semaphore->lock);
+
+    return taken;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_lock(&semaphore->lock);
+    BaseType_t given = semaphore->available ? pdFALSE : pdTRUE;
+    semaphore->available = true;
+    pthread_cond_signal(&semaphore->given);
+    pthread_mutex_unlock(&semaphore->lock);
+
+    return given;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_destroy(&semaphore->lock);
+    pthread_cond_destroy(&semaphore->given);
+    free(semaphore);
+}
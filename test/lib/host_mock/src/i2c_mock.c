@@ -0,0 +1,414 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "driver/i2c_master.h"
+#include "esp_timer.h"
+#include "i2c_mock.h"
+
+#define I2C_MOCK_MAX_DEVICES 8
+
+struct i2c_master_bus_t
+{
+    i2c_master_bus_config_t config;
+};
+
+struct i2c_master_dev_t
+{
+    bool in_use;
+    uint16_t address;
+    uint32_t scl_speed_hz;
+};
+
+typedef struct
+{
+    uint16_t address;
+    bool in_use;
+    i2c_mock_ssd1306_t model;
+    uint8_t cmd[8];
+    size_t cmd_size;
+    size_t cmd_expected;
+} i2c_mock_display_t;
+
+static struct i2c_master_bus_t mock_bus;
+static struct i2c_master_dev_t mock_devices[I2C_MOCK_MAX_DEVICES];
+static i2c_mock_display_t mock_displays[I2C_MOCK_MAX_DEVICES];
+static i2c_mock_transaction_t *mock_transactions;
+static size_t mock_transaction_count;
+static size_t mock_transaction_capacity;
+static size_t mock_wire_bytes;
+static uint64_t mock_bus_time_ns;
+static uint64_t mock_clock_ns;
+static esp_err_t mock_injected_err;
+static uint32_t mock_injected_count;
+static bool mock_realtime;
+static uint32_t mock_max_scl_hz;
+static uint32_t mock_failed_adds;
+static pthread_mutex_t mock_bus_lock = PTHREAD_MUTEX_INITIALIZER;
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code)
+    {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_FAIL:
+        return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:
+        return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:
+        return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:
+        return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:
+        return "ESP_ERR_TIMEOUT";
+    default:
+        return "UNKNOWN ERROR";
+    }
+}
+
+static void ssd1306_model_reset(i2c_mock_ssd1306_t *model)
+{
+    memset(model, 0, sizeof(*model));
+    model->addressing_mode = 0x02;
+    model->column_end = I2C_MOCK_SSD1306_COLUMNS - 1;
+    model->page_end = I2C_MOCK_SSD1306_PAGES - 1;
+}
+
+static i2c_mock_display_t *mock_display(uint16_t address)
+{
+    i2c_mock_display_t *free_slot = NULL;
+    for (size_t i = 0; i < I2C_MOCK_MAX_DEVICES; i++)
+    {
+        if (mock_displays[i].in_use && mock_displays[i].address == address)
+            return &mock_displays[i];
+        if (!mock_displays[i].in_use && free_slot == NULL)
+            free_slot = &mock_displays[i];
+    }
+    if (free_slot != NULL)
+    {
+        free_slot->in_use = true;
+        free_slot->address = address;
+        free_slot->cmd_size = 0;
+        free_slot->cmd_expected = 0;
+        ssd1306_model_reset(&free_slot->model);
+    }
+
+    return free_slot;
+}
+
+/* Number of argument bytes following an SSD1306 command opcode. */
+static size_t ssd1306_model_args(uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        return 1;
+    case 0x21: case 0x22: case 0xA3:
+        return 2;
+    case 0x29: case 0x2A:
+        return 5;
+    case 0x26: case 0x27: case 0x2C: case 0x2D:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+/* One-shot content scroll: the window rotates by one column. */
+static void ssd1306_model_content_scroll(i2c_mock_ssd1306_t *model, bool right, uint8_t initial_page, uint8_t final_page, uint8_t initial_column, uint8_t final_column)
+{
+    if (initial_column >= final_column)
+        return;
+    uint8_t length = final_column - initial_column;
+    for (uint8_t page = initial_page; page <= final_page; page++)
+    {
+        uint8_t *window = &model->ram[page][initial_column];
+        uint8_t wrapped = right ? window[length] : window[0];
+        memmove(right ? window + 1 : window, right ? window : window + 1, length);
+        window[right ? 0 : length] = wrapped;
+    }
+}
+
+static void ssd1306_model_command(i2c_mock_display_t *display)
+{
+    i2c_mock_ssd1306_t *model = &display->model;
+    uint8_t *cmd = display->cmd;
+
+    if (cmd[0] <= 0x0F)
+        model->column = (model->column & 0xF0) | cmd[0];
+    else if (cmd[0] <= 0x1F)
+        model->column = (model->column & 0x0F) | ((cmd[0] & 0x0F) << 4);
+    else if (cmd[0] == 0x20)
+        model->addressing_mode = cmd[1] & 0x03;
+    else if (cmd[0] == 0x21)
+    {
+        model->column_start = model->column = cmd[1] & 0x7F;
+        model->column_end = cmd[2] & 0x7F;
+    }
+    else if (cmd[0] == 0x22)
+    {
+        model->page_start = model->page = cmd[1] & 0x07;
+        model->page_end = cmd[2] & 0x07;
+    }
+    else if (cmd[0] == 0x26 || cmd[0] == 0x27 || cmd[0] == 0x29 || cmd[0] == 0x2A || cmd[0] == 0x2C || cmd[0] == 0x2D || cmd[0] == 0xA3)
+    {
+        memcpy(model->last_scroll_cmd, cmd, display->cmd_size);
+        model->last_scroll_cmd_size = display->cmd_size;
+        if (cmd[0] == 0x2C || cmd[0] == 0x2D)
+            ssd1306_model_content_scroll(model, cmd[0] == 0x2C, cmd[2] & 0x07, cmd[4] & 0x07, cmd[5] & 0x7F, cmd[6] & 0x7F);
+    }
+    else if (cmd[0] == 0x2E)
+        model->scroll_active = false;
+    else if (cmd[0] == 0x2F)
+        model->scroll_active = true;
+    else if (cmd[0] >= 0x40 && cmd[0] <= 0x7F)
+        model->start_line = cmd[0] & 0x3F;
+    else if (cmd[0] >= 0xB0 && cmd[0] <= 0xB7)
+        model->page = cmd[0] & 0x07;
+    else if (cmd[0] == 0xAE)
+        model->display_on = false;
+    else if (cmd[0] == 0xAF)
+        model->display_on = true;
+}
+
+static void ssd1306_model_data(i2c_mock_ssd1306_t *model, uint8_t data)
+{
+    model->ram[model->page][model->column] = data;
+    switch (model->addressing_mode)
+    {
+    case 0x00: /* Horizontal: column first, then page, both wrapping inside the window. */
+        if (model->column++ >= model->column_end)
+        {
+            model->column = model->column_start;
+            model->page = (model->page >= model->page_end) ? model->page_start : model->page + 1;
+        }
+        break;
+    case 0x01: /* Vertical: page first, then column. */
+        if (model->page++ >= model->page_end)
+        {
+            model->page = model->page_start;
+            model->column = (model->column >= model->column_end) ? model->column_start : model->column + 1;
+        }
+        break;
+    default: /* Page: the column pointer wraps inside the page. */
+        model->column = (model->column + 1) % I2C_MOCK_SSD1306_COLUMNS;
+        break;
+    }
+}
+
+static void ssd1306_model_transaction(i2c_mock_display_t *display, const uint8_t *data, size_t size)
+{
+    if (size == 0)
+        return;
+    if (data[0] == 0x40)
+    {
+        for (size_t i = 1; i < size; i++)
+            ssd1306_model_data(&display->model, data[i]);
+        return;
+    }
+    for (size_t i = 1; i < size; i++)
+    {
+        display->cmd[display->cmd_size++] = data[i];
+        if (display->cmd_size == 1)
+            display->cmd_expected = 1 + ssd1306_model_args(data[i]);
+        if (display->cmd_size == display->cmd_expected)
+        {
+            ssd1306_model_command(display);
+            display->cmd_size = 0;
+        }
+    }
+}
+
+void i2c_mock_reset(void)
+{
+    for (size_t i = 0; i < mock_transaction_count; i++)
+        free(mock_transactions[i].data);
+    mock_transaction_count = 0;
+    mock_wire_bytes = 0;
+    mock_bus_time_ns = 0;
+    mock_injected_count = 0;
+}
+
+void i2c_mock_reset_all(void)
+{
+    i2c_mock_reset();
+    memset(mock_displays, 0, sizeof(mock_displays));
+    mock_realtime = false;
+    mock_max_scl_hz = 0;
+    mock_failed_adds = 0;
+}
+
+size_t i2c_mock_transaction_count(void)
+{
+    return mock_transaction_count;
+}
+
+const i2c_mock_transaction_t *i2c_mock_get_transaction(size_t index)
+{
+    return (index < mock_transaction_count) ? &mock_transactions[index] : NULL;
+}
+
+size_t i2c_mock_wire_bytes(void)
+{
+    return mock_wire_bytes;
+}
+
+uint64_t i2c_mock_bus_time_ns(void)
+{
+    return mock_bus_time_ns;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    pthread_mutex_lock(&mock_bus_lock);
+    uint64_t now = mock_clock_ns;
+    pthread_mutex_unlock(&mock_bus_lock);
+
+    return (int64_t)(now / 1000);
+}
+
+void i2c_mock_set_realtime(bool realtime)
+{
+    mock_realtime = realtime;
+}
+
+void i2c_mock_set_max_scl_hz(uint32_t max_scl_hz)
+{
+    mock_max_scl_hz = max_scl_hz;
+}
+
+void i2c_mock_fail_add_device(uint32_t count)
+{
+    mock_failed_adds = count;
+}
+
+void i2c_mock_inject_error(esp_err_t err, uint32_t count)
+{
+    mock_injected_err = err;
+    mock_injected_count = count;
+}
+
+const i2c_mock_ssd1306_t *i2c_mock_ssd1306(uint16_t device_address)
+{
+    for (size_t i = 0; i < I2C_MOCK_MAX_DEVICES; i++)
+    {
+        if (mock_displays[i].in_use && mock_displays[i].address == device_address)
+            return &mock_displays[i].model;
+    }
+
+    return NULL;
+}
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t *bus_config, i2c_master_bus_handle_t *ret_bus_handle)
+{
+    mock_bus.config = *bus_config;
+    *ret_bus_handle = &mock_bus;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus_handle)
+{
+    (void)bus_handle;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus_handle, uint16_t address, int xfer_timeout_ms)
+{
+    (void)bus_handle;
+    (void)address;
+    (void)xfer_timeout_ms;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus_handle, const i2c_device_config_t *dev_config, i2c_master_dev_handle_t *ret_handle)
+{
+    (void)bus_handle;
+    if (mock_failed_adds > 0)
+    {
+        mock_failed_adds--;
+        return ESP_ERR_NO_MEM;
+    }
+    for (size_t i = 0; i < I2C_MOCK_MAX_DEVICES; i++)
+    {
+        if (mock_devices[i].in_use)
+            continue;
+        if (mock_display(dev_config->device_address) == NULL)
+            return ESP_ERR_NO_MEM;
+        mock_devices[i].in_use = true;
+        mock_devices[i].address = dev_config->device_address;
+        mock_devices[i].scl_speed_hz = dev_config->scl_speed_hz;
+        *ret_handle = &mock_devices[i];
+        return ESP_OK;
+    }
+
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t handle)
+{
+    handle->in_use = false;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size, int xfer_timeout_ms)
+{
+    /* The driver rejects a NULL handle; a removed one would be a use after free. */
+    if (i2c_dev == NULL || !i2c_dev->in_use)
+        return ESP_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&mock_bus_lock);
+    if (mock_injected_count > 0)
+    {
+        mock_injected_count--;
+        /* A timed out transfer blocks for the whole timeout. */
+        if (mock_injected_err == ESP_ERR_TIMEOUT)
+            mock_clock_ns += (uint64_t)xfer_timeout_ms * 1000000ULL;
+        pthread_mutex_unlock(&mock_bus_lock);
+        return mock_injected_err;
+    }
+
+    if (mock_max_scl_hz && i2c_dev->scl_speed_hz > mock_max_scl_hz)
+    {
+        /* The device misses the address at a clock it cannot follow; the transfer ends without a payload. */
+        mock_clock_ns += ((uint64_t)9 + 2) * 1000000000ULL / i2c_dev->scl_speed_hz;
+        pthread_mutex_unlock(&mock_bus_lock);
+        return ESP_FAIL;
+    }
+
+    if (mock_transaction_count == mock_transaction_capacity)
+    {
+        mock_transaction_capacity = mock_transaction_capacity ? mock_transaction_capacity * 2 : 64;
+        mock_transactions = realloc(mock_transactions, mock_transaction_capacity * sizeof(i2c_mock_transaction_t));
+    }
+    i2c_mock_transaction_t *transaction = &mock_transactions[mock_transaction_count++];
+    transaction->device_address = i2c_dev->address;
+    transaction->scl_speed_hz = i2c_dev->scl_speed_hz;
+    transaction->size = write_size;
+    transaction->data = malloc(write_size ? write_size : 1);
+    memcpy(transaction->data, write_buffer, write_size);
+    transaction->bus_time_ns = ((write_size + 1) * 9 + 2) * 1000000000ULL / i2c_dev->scl_speed_hz;
+
+    mock_wire_bytes += write_size + 1;
+    mock_bus_time_ns += transaction->bus_time_ns;
+    mock_clock_ns += transaction->bus_time_ns;
+    ssd1306_model_transaction(mock_display(i2c_dev->address), write_buffer, write_size);
+    if (mock_realtime)
+    {
+        struct timespec bus_time = {.tv_sec = 0, .tv_nsec = (long)transaction->bus_time_ns};
+        nanosleep(&bus_time, NULL);
+    }
+    pthread_mutex_unlock(&mock_bus_lock);
+
+    return ESP_OK;
+}
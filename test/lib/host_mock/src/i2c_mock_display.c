@@ -0,0 +1,82 @@
+#include <string.h>
+#include "i2c_mock_display.h"
+
+#define I2C_MOCK_DISPLAY_SLOTS 4
+
+/* Framebuffer storage of the fixture displays, bound to their handles on first use. */
+static struct
+{
+    const i2c_ssd1306_handle_t *handle;
+    uint8_t framebuffer[SSD1306_FRAMEBUFFER_SIZE(SSD1306_MAX_WIDTH, SSD1306_MAX_PAGES * 8)] __attribute__((aligned(4)));
+} display_slots[I2C_MOCK_DISPLAY_SLOTS];
+
+static uint8_t *display_storage(const i2c_ssd1306_handle_t *handle)
+{
+    for (int i = 0; i < I2C_MOCK_DISPLAY_SLOTS; i++)
+    {
+        if (display_slots[i].handle == handle || display_slots[i].handle == NULL)
+        {
+            display_slots[i].handle = handle;
+            return display_slots[i].framebuffer;
+        }
+    }
+
+    return NULL;
+}
+
+esp_err_t i2c_mock_init_display(uint8_t height, ssd1306_addressing_t addressing, i2c_master_bus_handle_t *bus, i2c_ssd1306_handle_t *handle)
+{
+    return i2c_mock_init_display_at(0x3C, 128, height, addressing, bus, handle);
+}
+
+esp_err_t i2c_mock_init_display_at(uint16_t device_address, uint8_t width, uint8_t height, ssd1306_addressing_t addressing, i2c_master_bus_handle_t *bus, i2c_ssd1306_handle_t *handle)
+{
+    i2c_master_bus_config_t i2c_master_bus_config = {.i2c_port = I2C_NUM_0};
+    i2c_ssd1306_config_t i2c_ssd1306_config = {
+        .i2c_device_address = device_address,
+        .i2c_scl_speed_hz = 400000,
+        .width = width,
+        .height = height,
+        .wise = SSD1306_BOTTOM_TO_TOP,
+        .addressing = addressing,
+        .framebuffer = display_storage(handle)};
+    if (i2c_ssd1306_config.framebuffer == NULL)
+        return ESP_ERR_NO_MEM;
+
+    i2c_new_master_bus(&i2c_master_bus_config, bus);
+    esp_err_t err = i2c_ssd1306_init(*bus, i2c_ssd1306_config, handle);
+    i2c_mock_reset();
+
+    return err;
+}
+
+esp_err_t i2c_mock_decode_image(const ssd1306_image_t *image, uint8_t *strips)
+{
+    static i2c_ssd1306_handle_t decoder;
+    i2c_master_bus_handle_t bus;
+    esp_err_t err = i2c_mock_init_display_at(0x3D, image->width, image->height, SSD1306_ADDRESSING_PAGE, &bus, &decoder);
+    if (err != ESP_OK)
+        return err;
+    err = i2c_ssd1306_buffer_image_asset(&decoder, 0, 0, image, false);
+    memcpy(strips, decoder.framebuffer, image->width * (image->height / 8));
+    i2c_ssd1306_deinit(&decoder);
+
+    return err;
+}
+
+int i2c_mock_ram_mismatch(const i2c_ssd1306_handle_t *handle, uint16_t device_address)
+{
+    const i2c_mock_ssd1306_t *model = i2c_mock_ssd1306(device_address);
+    if (model == NULL)
+        return -2;
+    for (uint8_t page = 0; page < handle->total_pages; page++)
+    {
+        for (uint8_t x = 0; x < handle->width; x++)
+        {
+            if (handle->framebuffer[page * handle->width + x] != model->ram[page][x])
+                return page * handle->width + x;
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,105 @@
+#include <string.h>
+#include "nvs_flash.h"
+
+#define NVS_MOCK_MAX_ENTRIES 16
+#define NVS_MOCK_NAME_SIZE 16
+
+typedef struct
+{
+    char namespace_name[NVS_MOCK_NAME_SIZE];
+    char key[NVS_MOCK_NAME_SIZE];
+    uint32_t value;
+} nvs_mock_entry_t;
+
+static bool nvs_initialized;
+static nvs_mock_entry_t nvs_entries[NVS_MOCK_MAX_ENTRIES];
+static size_t nvs_entry_count;
+static char nvs_namespaces[NVS_MOCK_MAX_ENTRIES][NVS_MOCK_NAME_SIZE];
+static size_t nvs_namespace_count;
+
+esp_err_t nvs_flash_init(void)
+{
+    nvs_initialized = true;
+
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void)
+{
+    nvs_entry_count = 0;
+
+    return ESP_OK;
+}
+
+/* Handles are 1-based indexes into the namespace table. */
+esp_err_t nvs_open(const char *namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    (void)open_mode;
+    if (!nvs_initialized)
+        return ESP_ERR_NVS_NOT_INITIALIZED;
+    for (size_t i = 0; i < nvs_namespace_count; i++)
+    {
+        if (strncmp(nvs_namespaces[i], namespace_name, NVS_MOCK_NAME_SIZE - 1) == 0)
+        {
+            *out_handle = i + 1;
+            return ESP_OK;
+        }
+    }
+    if (nvs_namespace_count == NVS_MOCK_MAX_ENTRIES)
+        return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+    strncpy(nvs_namespaces[nvs_namespace_count], namespace_name, NVS_MOCK_NAME_SIZE - 1);
+    *out_handle = ++nvs_namespace_count;
+
+    return ESP_OK;
+}
+
+static nvs_mock_entry_t *nvs_mock_find(nvs_handle_t handle, const char *key)
+{
+    for (size_t i = 0; i < nvs_entry_count; i++)
+    {
+        if (strcmp(nvs_entries[i].namespace_name, nvs_namespaces[handle - 1]) == 0 && strncmp(nvs_entries[i].key, key, NVS_MOCK_NAME_SIZE - 1) == 0)
+            return &nvs_entries[i];
+    }
+
+    return NULL;
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out_value)
+{
+    if (handle == 0 || handle > nvs_namespace_count)
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    nvs_mock_entry_t *entry = nvs_mock_find(handle, key);
+    if (entry == NULL)
+        return ESP_ERR_NVS_NOT_FOUND;
+    *out_value = entry->value;
+
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value)
+{
+    if (handle == 0 || handle > nvs_namespace_count)
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    nvs_mock_entry_t *entry = nvs_mock_find(handle, key);
+    if (entry == NULL)
+    {
+        if (nvs_entry_count == NVS_MOCK_MAX_ENTRIES)
+            return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+        entry = &nvs_entries[nvs_entry_count++];
+        strncpy(entry->namespace_name, nvs_namespaces[handle - 1], NVS_MOCK_NAME_SIZE - 1);
+        strncpy(entry->key, key, NVS_MOCK_NAME_SIZE - 1);
+    }
+    entry->value = value;
+
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    return (handle == 0 || handle > nvs_namespace_count) ? ESP_ERR_NVS_INVALID_HANDLE : ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    (void)handle;
+}
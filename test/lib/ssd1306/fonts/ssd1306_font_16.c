@@ -0,0 +1,227 @@
+/* Generated by tools/ssd1306_fontgen.py from DejaVuSans-Bold.ttf; do not edit. */
+
+#include "ssd1306_font.h"
+
+static const uint8_t ssd1306_font_16_bitmaps[1732] __attribute__((aligned(4))) = {
+    0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x0E, 0x1E, 0x00, 0x00, 0x1E,
+    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0xF8, 0xBE, 0x92, 0xF0,
+    0xFC, 0xBE, 0x90, 0x10, 0x00, 0x01, 0x01, 0x0F, 0x03, 0x01, 0x0D, 0x0F, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x30, 0x78, 0xFC, 0xEC, 0xFF, 0xCC, 0xCC, 0x8C, 0x00, 0x00, 0x04, 0x0C, 0x0C, 0x0C, 0x3F,
+    0x0C, 0x0F, 0x07, 0x03, 0x00, 0x3E, 0x76, 0x62, 0x66, 0x3E, 0x88, 0xE0, 0x70, 0x9C, 0xC6, 0xC2,
+    0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x06, 0x03, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x08,
+    0x0F, 0x07, 0x00, 0x80, 0xE0, 0xFE, 0x7E, 0x76, 0xE2, 0xC2, 0x86, 0x80, 0xE0, 0xE0, 0x00, 0x03,
+    0x07, 0x0F, 0x0C, 0x0C, 0x0D, 0x0F, 0x07, 0x0F, 0x0F, 0x08, 0x00, 0x0E, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFC, 0xFE, 0x07, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0x38, 0x20, 0x00, 0x00, 0x07, 0xFF,
+    0xFC, 0xE0, 0x00, 0x00, 0x38, 0x3F, 0x0F, 0x01, 0x00, 0x24, 0x38, 0x7E, 0xFE, 0x38, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xC0,
+    0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x3E, 0x1E, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0xFC, 0x0E, 0x10,
+    0x1E, 0x07, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFE, 0x06, 0x06, 0x06, 0xFE, 0xFC, 0xF8, 0x00, 0x03,
+    0x07, 0x0F, 0x0C, 0x0C, 0x0C, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x06, 0x06, 0xFE, 0xFE, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0F, 0x0F, 0x0F, 0x0C, 0x0C, 0x0C, 0x00, 0x06, 0x06, 0x06,
+    0x86, 0xC6, 0xFE, 0x7E, 0x3C, 0x00, 0x0C, 0x0E, 0x0F, 0x0F, 0x0D, 0x0C, 0x0C, 0x0C, 0x00, 0x00,
+    0x06, 0x66, 0x66, 0x66, 0xFE, 0xFE, 0x9C, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x07,
+    0x00, 0xC0, 0xE0, 0x38, 0x1C, 0x0E, 0xFE, 0xFE, 0x80, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x0F, 0x0F, 0x03, 0x03, 0x00, 0x00, 0x7E, 0x7E, 0x26, 0x76, 0x66, 0xE6, 0xE6, 0x80, 0x00, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x07, 0x03, 0x00, 0xF0, 0xFC, 0xFE, 0x66, 0x66, 0x66, 0xE6,
+    0xE6, 0xC0, 0x00, 0x03, 0x07, 0x0F, 0x0C, 0x0C, 0x0C, 0x0F, 0x07, 0x03, 0x00, 0x06, 0x06, 0x06,
+    0x86, 0xE6, 0xFE, 0x7E, 0x1E, 0x02, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x9C, 0xFE, 0xFE, 0x66, 0x63, 0x66, 0xFE, 0xDE, 0x08, 0x00, 0x07, 0x0F, 0x0F, 0x0C, 0x0C,
+    0x0C, 0x0F, 0x07, 0x03, 0x00, 0x7C, 0xFE, 0xFE, 0xC6, 0xC2, 0xE6, 0xFE, 0xFC, 0xF0, 0x00, 0x00,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x00, 0x00, 0x00, 0x78, 0x78, 0x00, 0x00, 0x0E, 0x0E,
+    0x00, 0x00, 0x78, 0x78, 0x00, 0x30, 0x3E, 0x1E, 0x00, 0x00, 0xC0, 0xC0, 0xE0, 0x60, 0x20, 0x30,
+    0x30, 0x18, 0x18, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x06, 0x06, 0x00, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x18, 0x18, 0x30, 0x30, 0x20, 0x60, 0xE0, 0xC0, 0xC0, 0x00,
+    0x00, 0x06, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x06, 0x06, 0xC6, 0xE6, 0x7E,
+    0x3E, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x18, 0x0C, 0xE4,
+    0x66, 0x26, 0x26, 0xE6, 0xE4, 0x0C, 0x18, 0xF0, 0x00, 0x03, 0x0E, 0x18, 0x30, 0x27, 0x66, 0x64,
+    0x64, 0x27, 0x27, 0x34, 0x06, 0x03, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0x1E, 0x1E, 0xFE, 0xF8, 0xC0,
+    0x00, 0x00, 0x08, 0x0F, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0x08, 0x00, 0xFE,
+    0xFE, 0xFE, 0x66, 0x66, 0x66, 0xFE, 0xFE, 0xDC, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0C, 0x0C, 0x0C,
+    0x0E, 0x0F, 0x07, 0x03, 0x00, 0xF8, 0xFC, 0xFE, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x01,
+    0x07, 0x07, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0xFE, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06,
+    0x0E, 0xFC, 0xFC, 0xF0, 0x00, 0x0F, 0x0F, 0x0F, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x07, 0x03, 0x01,
+    0x00, 0xFE, 0xFE, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x0F, 0x0F, 0x0F, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x00, 0xFE, 0xFE, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x0F, 0x0F, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFE, 0x0E, 0x06, 0x06, 0xC6, 0xC6, 0xC6, 0xC6, 0xC0,
+    0x00, 0x01, 0x07, 0x07, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F, 0x0F, 0x07, 0x00, 0xFE, 0xFE, 0xFE,
+    0x60, 0x60, 0x60, 0x60, 0xE0, 0xFE, 0xFE, 0xFE, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xFE, 0xFE, 0xFE,
+    0x60, 0x7F, 0x7F, 0x3F, 0x00, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF8, 0x9C, 0x0E, 0x06, 0x02, 0x00,
+    0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x0C, 0x08, 0x00, 0xFE, 0xFE, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0xFE,
+    0xFE, 0xFE, 0x1E, 0x7C, 0xF0, 0xC0, 0xE0, 0xF8, 0x1E, 0xFE, 0xFE, 0xFE, 0x00, 0x0F, 0x0F, 0x0F,
+    0x00, 0x00, 0x01, 0x03, 0x03, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xFE, 0xFE, 0xFE, 0x1E, 0x7C,
+    0xF0, 0xC0, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x00, 0xF8, 0xFC, 0xFE, 0x0E, 0x06, 0x07, 0x06, 0x0E, 0xFE, 0xFC, 0xF8, 0x00, 0x03,
+    0x07, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x07, 0x03, 0x00, 0xFE, 0xFE, 0xFE, 0xC6, 0xC6,
+    0xC6, 0xEE, 0xFE, 0x7C, 0x38, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFC, 0xFE, 0x0E, 0x06, 0x07, 0x06, 0x0E, 0xFE, 0xFC, 0xF8, 0x00, 0x03, 0x07, 0x0F,
+    0x0E, 0x0C, 0x0C, 0x1C, 0x3E, 0x3F, 0x27, 0x03, 0x00, 0xFE, 0xFE, 0xFE, 0xC6, 0xC6, 0xC6, 0xFE,
+    0xFE, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x0F, 0x0C, 0x00, 0x3C,
+    0x7E, 0x7E, 0x66, 0xE7, 0xE6, 0xE6, 0xC6, 0x80, 0x00, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F,
+    0x0F, 0x07, 0x06, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE,
+    0xFE, 0x00, 0x01, 0x07, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 0x0F, 0x07, 0x03, 0x02, 0x1E, 0x7E, 0xFC,
+    0xE0, 0x00, 0x00, 0xE0, 0xFC, 0x7E, 0x0E, 0x02, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xFC, 0xC0, 0x00, 0xF8, 0xFE, 0x0E, 0xFE, 0xF8, 0x80,
+    0xC0, 0xFC, 0xFE, 0x1E, 0x00, 0x00, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x01, 0x00, 0x00, 0x02, 0x0E, 0x9E, 0xFC, 0xF0, 0xF0, 0xFC, 0x9E, 0x0E, 0x02, 0x00,
+    0x0C, 0x0E, 0x0F, 0x03, 0x01, 0x01, 0x03, 0x0F, 0x0E, 0x0C, 0x02, 0x06, 0x1E, 0x3E, 0xF8, 0xF0,
+    0xF8, 0x7C, 0x1E, 0x0E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x06, 0x86, 0xC6, 0xF6, 0x7E, 0x3E, 0x1E, 0x0E, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x0F,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x3F, 0x3F, 0x3F,
+    0x30, 0x30, 0x02, 0x3E, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x1C, 0x00, 0x03, 0x03, 0xFF,
+    0xFF, 0xFF, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x10, 0x18, 0x0C, 0x06, 0x06, 0x06,
+    0x0C, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00,
+    0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x98, 0x98, 0x98, 0xF8, 0xF0, 0xE0, 0x00,
+    0x07, 0x0F, 0x0D, 0x0C, 0x0C, 0x0F, 0x0F, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0x30, 0x10, 0x18, 0x78,
+    0xF0, 0xE0, 0x00, 0x0F, 0x0F, 0x0F, 0x04, 0x0C, 0x0C, 0x0E, 0x0F, 0x07, 0x00, 0xE0, 0xF0, 0xF0,
+    0x38, 0x18, 0x18, 0x30, 0x00, 0x07, 0x07, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0xE0, 0xF0, 0xF8,
+    0x38, 0x10, 0x30, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0x0F, 0x0F, 0x0C, 0x0C, 0x04, 0x0F, 0x0F, 0x0F,
+    0x00, 0xE0, 0xF0, 0xF0, 0x98, 0x98, 0xB8, 0xF0, 0xE0, 0xC0, 0x00, 0x07, 0x07, 0x0F, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x00, 0x10, 0x38, 0xFE, 0xFF, 0x3B, 0x3B, 0x13, 0x00, 0x00, 0x0F, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xF0, 0xF8, 0x38, 0x10, 0x30, 0xF0, 0xF8, 0xF0, 0x00, 0x03, 0x67, 0x6F,
+    0x6C, 0x6C, 0x66, 0x7F, 0x3F, 0x1F, 0x00, 0xFF, 0xFF, 0xFF, 0x30, 0x10, 0x38, 0xF8, 0xF0, 0xE0,
+    0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xF3, 0xFF, 0xF3, 0x00, 0x0F,
+    0x0F, 0x0F, 0x00, 0xF3, 0xFF, 0xF3, 0x60, 0x7F, 0x7F, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0,
+    0x70, 0x30, 0x18, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x01, 0x03, 0x07, 0x0E, 0x0C, 0x08, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xF0, 0xF8, 0xF0, 0x30, 0x10, 0x38, 0xF0, 0xF0, 0x70,
+    0x30, 0x38, 0xF8, 0xF0, 0xE0, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00,
+    0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xF0, 0xF8, 0xF0, 0x30, 0x10, 0x38, 0xF8, 0xF0, 0xE0, 0x00, 0x0F,
+    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xE0, 0xF0, 0x70, 0x18, 0x18, 0x38, 0xF0,
+    0xF0, 0xC0, 0x00, 0x07, 0x07, 0x0F, 0x0C, 0x0C, 0x0C, 0x0F, 0x07, 0x03, 0x00, 0xF0, 0xF8, 0xF0,
+    0x30, 0x10, 0x18, 0x78, 0xF0, 0xE0, 0x00, 0x7F, 0x7F, 0x7F, 0x04, 0x0C, 0x0C, 0x0E, 0x0F, 0x07,
+    0x00, 0xE0, 0xF0, 0xF8, 0x38, 0x10, 0x30, 0xF0, 0xF8, 0xF0, 0x00, 0x07, 0x0F, 0x0F, 0x0C, 0x0C,
+    0x04, 0x7F, 0x7F, 0x7F, 0x00, 0xF0, 0xF8, 0xF0, 0x30, 0x30, 0x38, 0x10, 0x00, 0x0F, 0x0F, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xD8, 0x98, 0x98, 0x90, 0xB0, 0x00, 0x0C, 0x0C, 0x0D,
+    0x0D, 0x0D, 0x0F, 0x07, 0x10, 0x38, 0xFE, 0xFE, 0x38, 0x38, 0x38, 0x00, 0x00, 0x0F, 0x0F, 0x0C,
+    0x0C, 0x0C, 0x00, 0xF0, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xF0, 0x00, 0x03, 0x0F, 0x0F,
+    0x0C, 0x0C, 0x06, 0x0F, 0x0F, 0x0F, 0x00, 0x78, 0xF0, 0xE0, 0x00, 0x00, 0xE0, 0xF0, 0x78, 0x00,
+    0x00, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x00, 0x00, 0x78, 0xF8, 0xE0, 0x00, 0xC0, 0xF0, 0xF8,
+    0xF0, 0x00, 0xC0, 0xF0, 0xF8, 0x00, 0x00, 0x07, 0x0F, 0x0F, 0x0F, 0x01, 0x00, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x00, 0x00, 0x18, 0x38, 0xF0, 0xE0, 0xE0, 0xF0, 0x38, 0x18, 0x00, 0x0C, 0x0E, 0x07, 0x03,
+    0x03, 0x07, 0x0E, 0x0C, 0x00, 0x78, 0xF0, 0xE0, 0x00, 0x00, 0xE0, 0xF0, 0x78, 0x00, 0x00, 0x61,
+    0x67, 0x7F, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x38, 0x38, 0xB8, 0xF8, 0xF8, 0x78, 0x38, 0x00, 0x0E,
+    0x0F, 0x0F, 0x0D, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x80, 0xC0, 0xFC, 0xFE, 0x7F, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x01, 0x1F, 0x3F, 0x3F, 0x60, 0x60, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x7F,
+    0x00, 0x00, 0x03, 0x03, 0x7F, 0xFE, 0xFC, 0xC0, 0x80, 0x00, 0x00, 0x60, 0x60, 0x3F, 0x3F, 0x1F,
+    0x01, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x1E, 0x13, 0x12, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+static const ssd1306_glyph_t ssd1306_font_16_glyphs[96] = {
+    {0, 0, 5}, // U+0020
+    {0, 5, 7}, // !
+    {10, 7, 8}, // "
+    {24, 12, 13}, // #
+    {48, 10, 11}, // $
+    {68, 15, 15}, // %
+    {98, 12, 13}, // &
+    {122, 3, 5}, // '
+    {128, 6, 7}, // (
+    {140, 6, 7}, // )
+    {152, 8, 8}, // *
+    {168, 11, 13}, // +
+    {190, 4, 6}, // ,
+    {198, 6, 6}, // -
+    {210, 4, 6}, // .
+    {218, 5, 6}, // /
+    {228, 10, 11}, // 0
+    {248, 10, 11}, // 1
+    {268, 9, 11}, // 2
+    {286, 9, 11}, // 3
+    {304, 10, 11}, // 4
+    {324, 10, 11}, // 5
+    {344, 10, 11}, // 6
+    {364, 10, 11}, // 7
+    {384, 10, 11}, // 8
+    {404, 10, 11}, // 9
+    {424, 4, 6}, // :
+    {432, 4, 6}, // ;
+    {440, 11, 13}, // <
+    {462, 11, 13}, // =
+    {484, 11, 13}, // >
+    {506, 8, 9}, // ?
+    {522, 14, 15}, // @
+    {550, 12, 12}, // A
+    {574, 11, 12}, // B
+    {596, 10, 11}, // C
+    {616, 12, 13}, // D
+    {640, 9, 11}, // E
+    {658, 9, 11}, // F
+    {676, 12, 13}, // G
+    {700, 12, 13}, // H
+    {724, 4, 6}, // I
+    {732, 4, 6}, // J
+    {740, 12, 12}, // K
+    {764, 9, 10}, // L
+    {782, 14, 15}, // M
+    {810, 12, 13}, // N
+    {834, 12, 13}, // O
+    {858, 11, 11}, // P
+    {880, 12, 13}, // Q
+    {904, 11, 12}, // R
+    {926, 10, 11}, // S
+    {946, 10, 11}, // T
+    {966, 11, 13}, // U
+    {988, 12, 12}, // V
+    {1012, 16, 17}, // W
+    {1044, 11, 12}, // X
+    {1066, 11, 11}, // Y
+    {1088, 11, 11}, // Z
+    {1110, 6, 7}, // [
+    {1122, 5, 6}, // U+005C
+    {1132, 6, 7}, // ]
+    {1144, 11, 13}, // ^
+    {1166, 8, 8}, // _
+    {1182, 4, 8}, // `
+    {1190, 9, 10}, // a
+    {1208, 10, 11}, // b
+    {1228, 8, 9}, // c
+    {1244, 10, 11}, // d
+    {1264, 10, 10}, // e
+    {1284, 7, 7}, // f
+    {1298, 10, 11}, // g
+    {1318, 10, 11}, // h
+    {1338, 4, 5}, // i
+    {1346, 4, 5}, // j
+    {1354, 10, 10}, // k
+    {1374, 4, 5}, // l
+    {1382, 15, 16}, // m
+    {1412, 10, 11}, // n
+    {1432, 10, 11}, // o
+    {1452, 10, 11}, // p
+    {1472, 10, 11}, // q
+    {1492, 8, 8}, // r
+    {1508, 8, 9}, // s
+    {1524, 7, 7}, // t
+    {1538, 10, 11}, // u
+    {1558, 9, 10}, // v
+    {1576, 13, 14}, // w
+    {1602, 9, 10}, // x
+    {1620, 9, 10}, // y
+    {1638, 8, 9}, // z
+    {1654, 9, 11}, // {
+    {1672, 4, 6}, // |
+    {1680, 9, 11}, // }
+    {1698, 11, 13}, // ~
+    {1720, 6, 8}, // U+00B0
+};
+
+static const ssd1306_font_range_t ssd1306_font_16_ranges[2] = {
+    {0x0020, 95, 0},
+    {0x00B0, 1, 95},
+};
+
+const ssd1306_font_t ssd1306_font_16 = {
+    .height = 16,
+    .range_count = 2,
+    .fallback = 31,
+    .ranges = ssd1306_font_16_ranges,
+    .glyphs = ssd1306_font_16_glyphs,
+    .bitmaps = ssd1306_font_16_bitmaps};
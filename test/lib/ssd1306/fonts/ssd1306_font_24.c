@@ -0,0 +1,364 @@
+/* Generated by tools/ssd1306_fontgen.py from DejaVuSans-Bold.ttf; do not edit. */
+
+#include "ssd1306_font.h"
+
+static const uint8_t ssd1306_font_24_bitmaps[3936] __attribute__((aligned(4))) = {
+    0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x87, 0x9F, 0x9F, 0x9F, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xFC, 0xBC, 0x80, 0x80, 0xC0,
+    0xF8, 0xFC, 0x88, 0x80, 0x80, 0x00, 0x00, 0x70, 0x71, 0x71, 0xF9, 0xFF, 0x7F, 0x73, 0x71, 0xF1,
+    0xFF, 0xFF, 0x7F, 0x71, 0x71, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x03, 0x00, 0x00,
+    0x04, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0x70,
+    0xFE, 0xFE, 0x70, 0x70, 0x70, 0x70, 0x60, 0x00, 0x00, 0x00, 0x87, 0x0F, 0x0F, 0x1F, 0x1E, 0xFF,
+    0xFF, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0x40, 0x00, 0x00, 0x03, 0x03, 0x07, 0x07, 0x07, 0x3F, 0x3F,
+    0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0x0C, 0x0C, 0x0C, 0xFC, 0xF8, 0xE0,
+    0x00, 0x00, 0x80, 0xE0, 0xF0, 0x3C, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07,
+    0x06, 0x06, 0x07, 0x87, 0xC3, 0xF0, 0x3C, 0x1E, 0x07, 0xC3, 0xF0, 0xF8, 0x1C, 0x0C, 0x0C, 0x3C,
+    0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0xFC,
+    0x9C, 0x1C, 0x1C, 0x1C, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFC, 0xFE, 0xFF,
+    0xCF, 0x07, 0x07, 0x0F, 0x3F, 0x7E, 0xFC, 0xF0, 0xE0, 0xF8, 0xFE, 0x7E, 0x1E, 0x00, 0x00, 0x00,
+    0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x07, 0x07, 0x07, 0x06,
+    0x04, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0x7E, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x1F, 0x3F, 0x3E, 0x38, 0x00, 0x00, 0x06, 0x1E, 0xFE, 0xFC, 0xF0, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x20, 0x3C, 0x3F, 0x3F,
+    0x0F, 0x03, 0x00, 0x00, 0x30, 0x30, 0x60, 0xE0, 0xFC, 0xFC, 0xE0, 0xE0, 0x30, 0x30, 0x00, 0x06,
+    0x03, 0x03, 0x01, 0x0F, 0x1F, 0x01, 0x01, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x20, 0x3F, 0x3F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x07,
+    0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0x1C, 0x00, 0x00, 0xE0, 0xFC, 0x7F,
+    0x0F, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xF8,
+    0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xF8, 0xF8, 0xE0, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x1C, 0x3C, 0xFC,
+    0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x38, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x7C, 0xFC,
+    0xF8, 0xF8, 0xE0, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0x78, 0x3C, 0x1F, 0x0F, 0x0F, 0x03,
+    0x01, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x18, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x0E, 0x0E, 0x0E, 0x0F, 0x9F, 0xFF, 0xFF, 0xF9, 0xF0, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0,
+    0x78, 0x7C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xEF, 0xE3, 0xE1, 0xE0,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x87, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x8F, 0xFF, 0xFF,
+    0xFE, 0xFC, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01,
+    0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x18, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x07, 0x07, 0x07, 0x8F, 0xFF, 0xFE, 0xFC, 0xF8, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xF0, 0xFC, 0xFF, 0x7F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x07,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C,
+    0x1C, 0xFC, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x60, 0xF8, 0xF9, 0xFF, 0xFF, 0x0F, 0x0E, 0x0E, 0x0F,
+    0x9F, 0xFF, 0xF9, 0xF9, 0xE0, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07,
+    0x07, 0x03, 0x03, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xF8,
+    0xF0, 0xE0, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x9C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x87, 0x87, 0x87, 0x87, 0x00,
+    0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00,
+    0x87, 0x87, 0x87, 0x87, 0x00, 0x00, 0x3C, 0x3F, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xE0, 0x00, 0x00, 0x18, 0x1C,
+    0x3C, 0x3E, 0x7E, 0x76, 0x67, 0xE7, 0xE3, 0xC3, 0xC3, 0xC1, 0x81, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x63, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0xC1, 0xC1, 0xC3, 0xE3, 0xE3, 0x67, 0x77, 0x76, 0x3E,
+    0x3C, 0x3C, 0x1C, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xF8, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x98, 0x9C, 0x9E, 0x9F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x30,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x30, 0x70, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFE, 0xCF, 0x03, 0x03, 0x03, 0x86, 0xFF, 0xFF, 0x80, 0x00,
+    0x80, 0xFF, 0x7F, 0x08, 0x00, 0x00, 0x01, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x71, 0x63, 0x63, 0x63,
+    0x63, 0x61, 0x73, 0x33, 0x3B, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0,
+    0xFC, 0xFC, 0x7C, 0xFC, 0xFC, 0xFC, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE7, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x80, 0x00, 0x04, 0x07,
+    0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04,
+    0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF8, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 0x9F, 0xFF, 0xFF, 0xF9, 0xF0,
+    0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+    0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x3C, 0x1C, 0x1C, 0x3C, 0x3C, 0x3C, 0x78, 0xF8, 0xF0, 0xF0,
+    0xE0, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8,
+    0x7C, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0x38, 0x38, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x01,
+    0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0xFC,
+    0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x78,
+    0x7F, 0x7F, 0x3F, 0x1F, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0xF8,
+    0x7C, 0x3C, 0x1C, 0x0C, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x3F, 0x7F,
+    0xF9, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x06, 0x04, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF0, 0xC0, 0x00, 0x00,
+    0x00, 0x80, 0xF0, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x03, 0x0F, 0x3F, 0xFE, 0xF8, 0xFE, 0x3F, 0x0F, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x07, 0x07, 0x07, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00,
+    0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x0F, 0x3F, 0x7E, 0xF8,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x3C, 0x7C, 0xF8, 0xF0, 0xF0, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C, 0x3C, 0x7C, 0xF8, 0xF8, 0xF0, 0xE0, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1F, 0x1F, 0x0F, 0x0F, 0x03, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0x7C, 0xF8, 0xF8, 0xF0,
+    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x0F,
+    0x1F, 0x3F, 0x3F, 0x3B, 0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x3C, 0x1C,
+    0x1C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x1C, 0x1C, 0x1E, 0x3E, 0xFF, 0xFF, 0xF3, 0xE1, 0x80, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 0x00, 0xF0, 0xF8, 0xFC,
+    0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0x38, 0x00, 0x00, 0x00, 0x83, 0x87, 0x07, 0x0F,
+    0x0F, 0x0F, 0x0E, 0x1E, 0x9E, 0xFE, 0xFC, 0xFC, 0xF0, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xFC, 0xFC,
+    0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x04, 0x3C, 0xFC, 0xFC, 0xFC,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFC, 0xFC, 0x3C, 0x04, 0x00, 0x00, 0x01,
+    0x07, 0x3F, 0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0xFC, 0xFC, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xFC, 0x7C, 0xFC, 0xFC,
+    0xE0, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xFC, 0xFC, 0xFC, 0x0C, 0x00, 0x00, 0x03, 0x3F, 0xFF, 0xFF,
+    0xFE, 0xE0, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x01, 0x1F, 0xFF, 0xFE, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1C, 0x3C,
+    0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x80, 0xE0, 0xF0, 0xFC, 0xFC, 0x3C, 0x1C, 0x04, 0x00, 0x00, 0x00,
+    0x80, 0xE0, 0xF1, 0xFF, 0x7F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF1, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x06,
+    0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x04, 0x04,
+    0x1C, 0x3C, 0xFC, 0xFC, 0xF0, 0xE0, 0x80, 0x00, 0xC0, 0xE0, 0xF8, 0xFC, 0x7C, 0x3C, 0x0C, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x9C, 0xDC, 0xFC, 0xFC, 0xFC, 0x7C,
+    0x3C, 0x08, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x38, 0x38, 0x38, 0x0C, 0x7C, 0xFC,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0xFF, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x0F, 0x1F, 0x1C, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0xFE, 0xFE, 0xFE, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x38, 0x38, 0x38, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x78, 0x3C, 0x1C, 0x3C, 0x38, 0x70, 0xE0, 0xC0, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xF1, 0xF9, 0xF9, 0x39, 0x19, 0x19, 0x19,
+    0x9B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x06, 0x06, 0x03, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x01, 0x01, 0x01, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x30, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00,
+    0x7C, 0xFF, 0xFF, 0xFF, 0xC7, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x01, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0x80, 0x80, 0xFE, 0xFE, 0xFE, 0xFC, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x87, 0x01, 0x01, 0x01, 0x03,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xBB, 0x39, 0x39, 0x39, 0x39, 0x3F, 0x3F, 0x3F,
+    0xBE, 0x18, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x03,
+    0x00, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0xFC, 0xFE, 0xCE, 0xCE, 0xCE, 0x01, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0x01, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x7C,
+    0xFF, 0xFF, 0xFF, 0xC7, 0x01, 0x01, 0x01, 0x83, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01,
+    0xE3, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE3, 0xFB, 0x7F, 0x7F, 0x3F, 0x07, 0x00, 0x00, 0xFE, 0xFE,
+    0xFE, 0xFE, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0x01, 0x01, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0xDE, 0xDE, 0xDE, 0xDE, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0xDE, 0xDE, 0xDE,
+    0xDE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00, 0xFE,
+    0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3C, 0x7E, 0xFF, 0xFF, 0xC7, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x06, 0x04, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0xC0, 0xC0,
+    0xC0, 0xC0, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x01, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x87,
+    0x01, 0x01, 0x01, 0x01, 0xC7, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x80,
+    0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x01,
+    0x01, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x87, 0x01, 0x01, 0x01,
+    0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x80, 0xC0, 0xC0, 0xC0,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x1F, 0x3F, 0x39, 0x39, 0x39, 0x79, 0xF1, 0xF1, 0xF3, 0xC0,
+    0x00, 0x03, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x03, 0x01, 0x80, 0xC0, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x03,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x00, 0xC0, 0xC0, 0xC0, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFE, 0xF0,
+    0xC0, 0xF0, 0xFC, 0xFF, 0x7F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+    0xC0, 0x80, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x01, 0x1F, 0xFF, 0xFF, 0xFE, 0xC0,
+    0xE0, 0xFF, 0x7F, 0x07, 0x3F, 0xFF, 0xF8, 0xC0, 0xF8, 0xFF, 0xFF, 0x3F, 0x07, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x03, 0x00,
+    0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x00,
+    0x00, 0x01, 0x83, 0xEF, 0xFF, 0xFE, 0x7C, 0xFE, 0xFF, 0xEF, 0x83, 0x01, 0x00, 0x00, 0x06, 0x07,
+    0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x04, 0x00, 0xC0, 0xC0, 0xC0, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x01, 0x07, 0x3F, 0xFF, 0xFE, 0xF0,
+    0xC0, 0xE0, 0xFC, 0xFF, 0x7F, 0x0F, 0x01, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE3, 0xFF, 0x7F, 0x3F,
+    0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0x00, 0x01, 0x81, 0xC1, 0xE1, 0xF1, 0x7D, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFC, 0xFC, 0xFC, 0x1E, 0x0E, 0x0E, 0x0C, 0x00, 0x00, 0x00, 0x18, 0x18, 0x3C, 0xFF, 0xFF, 0xFF,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x3F, 0x7F, 0x78,
+    0x70, 0x70, 0x20, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0xFE, 0xFC, 0xFC, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0x3C, 0x38, 0x18,
+    0x18, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x7F, 0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x18, 0x1C, 0x0C, 0x0C, 0x0C, 0x1C, 0x1C, 0x18, 0x38, 0x38, 0x38, 0x38, 0x1C,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFC, 0x8C, 0x8C, 0x8C, 0xDC, 0xF8, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const ssd1306_glyph_t ssd1306_font_24_glyphs[96] = {
+    {0, 0, 8}, // U+0020
+    {0, 7, 11}, // !
+    {21, 10, 12}, // "
+    {51, 18, 19}, // #
+    {105, 15, 16}, // $
+    {150, 22, 23}, // %
+    {216, 19, 20}, // &
+    {273, 5, 7}, // '
+    {288, 8, 11}, // (
+    {312, 9, 11}, // )
+    {339, 11, 12}, // *
+    {372, 17, 19}, // +
+    {423, 6, 9}, // ,
+    {441, 8, 10}, // -
+    {465, 6, 9}, // .
+    {483, 8, 8}, // /
+    {507, 15, 16}, // 0
+    {552, 15, 16}, // 1
+    {597, 14, 16}, // 2
+    {639, 14, 16}, // 3
+    {681, 15, 16}, // 4
+    {726, 14, 16}, // 5
+    {768, 15, 16}, // 6
+    {813, 14, 16}, // 7
+    {855, 15, 16}, // 8
+    {900, 15, 16}, // 9
+    {945, 7, 9}, // :
+    {966, 7, 9}, // ;
+    {987, 17, 19}, // <
+    {1038, 17, 19}, // =
+    {1089, 17, 19}, // >
+    {1140, 12, 13}, // ?
+    {1176, 22, 23}, // @
+    {1242, 18, 18}, // A
+    {1296, 16, 18}, // B
+    {1344, 16, 17}, // C
+    {1392, 18, 19}, // D
+    {1446, 14, 16}, // E
+    {1488, 14, 16}, // F
+    {1530, 17, 19}, // G
+    {1581, 17, 19}, // H
+    {1632, 6, 9}, // I
+    {1650, 6, 9}, // J
+    {1668, 18, 18}, // K
+    {1722, 14, 15}, // L
+    {1764, 21, 23}, // M
+    {1827, 17, 19}, // N
+    {1878, 19, 20}, // O
+    {1935, 16, 17}, // P
+    {1983, 19, 20}, // Q
+    {2040, 17, 18}, // R
+    {2091, 15, 17}, // S
+    {2136, 16, 16}, // T
+    {2184, 17, 19}, // U
+    {2235, 18, 18}, // V
+    {2289, 25, 26}, // W
+    {2364, 17, 18}, // X
+    {2415, 17, 17}, // Y
+    {2466, 16, 17}, // Z
+    {2514, 9, 11}, // [
+    {2541, 8, 8}, // U+005C
+    {2565, 9, 11}, // ]
+    {2592, 16, 19}, // ^
+    {2640, 12, 12}, // _
+    {2676, 7, 12}, // `
+    {2697, 14, 16}, // a
+    {2739, 16, 17}, // b
+    {2787, 12, 14}, // c
+    {2823, 15, 17}, // d
+    {2868, 15, 16}, // e
+    {2913, 10, 10}, // f
+    {2943, 15, 17}, // g
+    {2988, 15, 16}, // h
+    {3033, 6, 8}, // i
+    {3051, 6, 8}, // j
+    {3069, 15, 15}, // k
+    {3114, 6, 8}, // l
+    {3132, 22, 24}, // m
+    {3198, 15, 16}, // n
+    {3243, 15, 16}, // o
+    {3288, 16, 17}, // p
+    {3336, 15, 17}, // q
+    {3381, 11, 11}, // r
+    {3414, 13, 14}, // s
+    {3453, 11, 11}, // t
+    {3486, 15, 16}, // u
+    {3531, 14, 15}, // v
+    {3573, 20, 21}, // w
+    {3633, 14, 15}, // x
+    {3675, 14, 15}, // y
+    {3717, 12, 13}, // z
+    {3753, 14, 16}, // {
+    {3795, 6, 8}, // |
+    {3813, 14, 16}, // }
+    {3855, 17, 19}, // ~
+    {3906, 10, 12}, // U+00B0
+};
+
+static const ssd1306_font_range_t ssd1306_font_24_ranges[2] = {
+    {0x0020, 95, 0},
+    {0x00B0, 1, 95},
+};
+
+const ssd1306_font_t ssd1306_font_24 = {
+    .height = 24,
+    .range_count = 2,
+    .fallback = 31,
+    .ranges = ssd1306_font_24_ranges,
+    .glyphs = ssd1306_font_24_glyphs,
+    .bitmaps = ssd1306_font_24_bitmaps};
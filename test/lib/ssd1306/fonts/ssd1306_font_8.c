@@ -0,0 +1,152 @@
+/* Generated by tools/ssd1306_fontgen.py from font8x8.bdf; do not edit. */
+
+#include "ssd1306_font.h"
+
+static const uint8_t ssd1306_font_8_bitmaps[565] __attribute__((aligned(4))) = {
+    0x5F, 0x5F, 0x07, 0x07, 0x00, 0x07, 0x07, 0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x24, 0x2A,
+    0x7F, 0x7F, 0x2A, 0x12, 0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x30, 0x7A, 0x4F, 0x5D, 0x37,
+    0x7A, 0x48, 0x07, 0x07, 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x3E, 0x1C, 0x08, 0x2A, 0x3E, 0x1C,
+    0x1C, 0x3E, 0x2A, 0x08, 0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x80, 0xE0, 0x60, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x60, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x3E, 0x7F, 0x51, 0x49,
+    0x45, 0x7F, 0x3E, 0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x72, 0x7B, 0x49, 0x49, 0x6F, 0x66, 0x22,
+    0x63, 0x49, 0x49, 0x7F, 0x36, 0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50, 0x2F, 0x6F, 0x49, 0x49,
+    0x79, 0x33, 0x3E, 0x7F, 0x49, 0x49, 0x7B, 0x32, 0x03, 0x03, 0x71, 0x79, 0x0F, 0x07, 0x36, 0x7F,
+    0x49, 0x49, 0x7F, 0x36, 0x26, 0x6F, 0x49, 0x49, 0x7F, 0x3E, 0x6C, 0x6C, 0x80, 0xEC, 0x6C, 0x08,
+    0x1C, 0x36, 0x63, 0x41, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x06,
+    0x07, 0x51, 0x59, 0x0F, 0x06, 0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x5F, 0x1E, 0x7C, 0x7E, 0x13, 0x13,
+    0x7E, 0x7C, 0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22,
+    0x41, 0x7F, 0x7F, 0x41, 0x63, 0x3E, 0x1C, 0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x41, 0x7F,
+    0x7F, 0x49, 0x1D, 0x01, 0x03, 0x1C, 0x3E, 0x63, 0x41, 0x51, 0x73, 0x72, 0x7F, 0x7F, 0x08, 0x08,
+    0x7F, 0x7F, 0x41, 0x41, 0x7F, 0x7F, 0x41, 0x41, 0x30, 0x70, 0x40, 0x41, 0x7F, 0x3F, 0x01, 0x41,
+    0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63, 0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x0E,
+    0x1C, 0x0E, 0x7F, 0x7F, 0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F, 0x1C, 0x3E, 0x63, 0x41, 0x63,
+    0x3E, 0x1C, 0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06, 0x3C, 0x7E, 0x43, 0x51, 0x33, 0x6E, 0x5C,
+    0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66, 0x26, 0x6F, 0x49, 0x49, 0x7B, 0x32, 0x03, 0x41, 0x7F,
+    0x7F, 0x41, 0x03, 0x3F, 0x7F, 0x40, 0x40, 0x7F, 0x3F, 0x1F, 0x3F, 0x60, 0x60, 0x3F, 0x1F, 0x7F,
+    0x7F, 0x30, 0x18, 0x30, 0x7F, 0x7F, 0x61, 0x73, 0x1E, 0x0C, 0x1E, 0x73, 0x61, 0x07, 0x4F, 0x78,
+    0x78, 0x4F, 0x07, 0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73, 0x7F, 0x7F, 0x41, 0x41, 0x01, 0x03,
+    0x06, 0x0C, 0x18, 0x30, 0x60, 0x41, 0x41, 0x7F, 0x7F, 0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x03, 0x06, 0x04, 0x20, 0x74, 0x54, 0x54,
+    0x3C, 0x78, 0x40, 0x41, 0x7F, 0x3F, 0x44, 0x44, 0x7C, 0x38, 0x38, 0x7C, 0x44, 0x44, 0x6C, 0x28,
+    0x38, 0x7C, 0x44, 0x45, 0x3F, 0x7F, 0x40, 0x38, 0x7C, 0x54, 0x54, 0x5C, 0x18, 0x48, 0x7E, 0x7F,
+    0x49, 0x03, 0x02, 0x98, 0xBC, 0xA4, 0xA4, 0xFC, 0x7C, 0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78,
+    0x44, 0x7D, 0x7D, 0x40, 0x60, 0xE0, 0x80, 0x84, 0xFD, 0x7D, 0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C,
+    0x44, 0x41, 0x7F, 0x7F, 0x40, 0x78, 0x7C, 0x0C, 0x38, 0x0C, 0x7C, 0x78, 0x04, 0x7C, 0x78, 0x04,
+    0x04, 0x7C, 0x78, 0x38, 0x7C, 0x44, 0x44, 0x7C, 0x38, 0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18,
+    0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84, 0x44, 0x7C, 0x78, 0x4C, 0x04, 0x0C, 0x08, 0x48, 0x5C,
+    0x54, 0x54, 0x74, 0x20, 0x04, 0x3F, 0x7F, 0x44, 0x64, 0x20, 0x3C, 0x7C, 0x40, 0x40, 0x7C, 0x7C,
+    0x1C, 0x3C, 0x60, 0x60, 0x3C, 0x1C, 0x3C, 0x7C, 0x60, 0x38, 0x60, 0x7C, 0x3C, 0x44, 0x6C, 0x38,
+    0x10, 0x38, 0x6C, 0x44, 0x9C, 0xBC, 0xA0, 0xA0, 0xFC, 0x7C, 0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64,
+    0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x7F, 0x7F, 0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x10, 0x18,
+    0x08, 0x18, 0x10, 0x18, 0x08,
+};
+
+static const ssd1306_glyph_t ssd1306_font_8_glyphs[95] = {
+    {0, 0, 4}, // U+0020
+    {0, 2, 3}, // !
+    {2, 5, 6}, // "
+    {7, 7, 8}, // #
+    {14, 6, 7}, // $
+    {20, 7, 8}, // %
+    {27, 7, 8}, // &
+    {34, 2, 3}, // '
+    {36, 4, 5}, // (
+    {40, 4, 5}, // )
+    {44, 8, 9}, // *
+    {52, 6, 7}, // +
+    {58, 3, 4}, // ,
+    {61, 6, 7}, // -
+    {67, 2, 3}, // .
+    {69, 7, 8}, // /
+    {76, 7, 8}, // 0
+    {83, 6, 7}, // 1
+    {89, 6, 7}, // 2
+    {95, 6, 7}, // 3
+    {101, 7, 8}, // 4
+    {108, 6, 7}, // 5
+    {114, 6, 7}, // 6
+    {120, 6, 7}, // 7
+    {126, 6, 7}, // 8
+    {132, 6, 7}, // 9
+    {138, 2, 3}, // :
+    {140, 3, 4}, // ;
+    {143, 5, 6}, // <
+    {148, 6, 7}, // =
+    {154, 5, 6}, // >
+    {159, 6, 7}, // ?
+    {165, 7, 8}, // @
+    {172, 6, 7}, // A
+    {178, 7, 8}, // B
+    {185, 7, 8}, // C
+    {192, 7, 8}, // D
+    {199, 7, 8}, // E
+    {206, 7, 8}, // F
+    {213, 7, 8}, // G
+    {220, 6, 7}, // H
+    {226, 6, 7}, // I
+    {232, 7, 8}, // J
+    {239, 7, 8}, // K
+    {246, 7, 8}, // L
+    {253, 7, 8}, // M
+    {260, 7, 8}, // N
+    {267, 7, 8}, // O
+    {274, 7, 8}, // P
+    {281, 7, 8}, // Q
+    {288, 7, 8}, // R
+    {295, 6, 7}, // S
+    {301, 6, 7}, // T
+    {307, 6, 7}, // U
+    {313, 6, 7}, // V
+    {319, 7, 8}, // W
+    {326, 7, 8}, // X
+    {333, 6, 7}, // Y
+    {339, 7, 8}, // Z
+    {346, 4, 5}, // [
+    {350, 7, 8}, // U+005C
+    {357, 4, 5}, // ]
+    {361, 7, 8}, // ^
+    {368, 8, 9}, // _
+    {376, 4, 5}, // `
+    {380, 7, 8}, // a
+    {387, 7, 8}, // b
+    {394, 6, 7}, // c
+    {400, 7, 8}, // d
+    {407, 6, 7}, // e
+    {413, 6, 7}, // f
+    {419, 6, 7}, // g
+    {425, 7, 8}, // h
+    {432, 4, 5}, // i
+    {436, 6, 7}, // j
+    {442, 7, 8}, // k
+    {449, 4, 5}, // l
+    {453, 7, 8}, // m
+    {460, 7, 8}, // n
+    {467, 6, 7}, // o
+    {473, 7, 8}, // p
+    {480, 7, 8}, // q
+    {487, 7, 8}, // r
+    {494, 6, 7}, // s
+    {500, 6, 7}, // t
+    {506, 6, 7}, // u
+    {512, 6, 7}, // v
+    {518, 7, 8}, // w
+    {525, 7, 8}, // x
+    {532, 6, 7}, // y
+    {538, 6, 7}, // z
+    {544, 6, 7}, // {
+    {550, 2, 3}, // |
+    {552, 6, 7}, // }
+    {558, 7, 8}, // ~
+};
+
+static const ssd1306_font_range_t ssd1306_font_8_ranges[1] = {
+    {0x0020, 95, 0},
+};
+
+const ssd1306_font_t ssd1306_font_8 = {
+    .height = 8,
+    .range_count = 1,
+    .fallback = 31,
+    .ranges = ssd1306_font_8_ranges,
+    .glyphs = ssd1306_font_8_glyphs,
+    .bitmaps = ssd1306_font_8_bitmaps};
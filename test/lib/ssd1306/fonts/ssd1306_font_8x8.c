@@ -0,0 +1,164 @@
+/* Generated by tools/ssd1306_fontgen.py from font8x8.bdf; do not edit. */
+
+#include "ssd1306_font.h"
+
+static const uint8_t ssd1306_font_8x8_bitmaps[760] __attribute__((aligned(4))) = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x00,
+    0x00, 0x24, 0x2A, 0x7F, 0x7F, 0x2A, 0x12, 0x00, 0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x00,
+    0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x00, 0x00, 0x00, 0x00, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x00,
+    0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08, 0x00, 0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00,
+    0x3E, 0x7F, 0x51, 0x49, 0x45, 0x7F, 0x3E, 0x00, 0x00, 0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x00,
+    0x00, 0x72, 0x7B, 0x49, 0x49, 0x6F, 0x66, 0x00, 0x00, 0x22, 0x63, 0x49, 0x49, 0x7F, 0x36, 0x00,
+    0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50, 0x00, 0x00, 0x2F, 0x6F, 0x49, 0x49, 0x79, 0x33, 0x00,
+    0x00, 0x3E, 0x7F, 0x49, 0x49, 0x7B, 0x32, 0x00, 0x00, 0x03, 0x03, 0x71, 0x79, 0x0F, 0x07, 0x00,
+    0x00, 0x36, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x00, 0x26, 0x6F, 0x49, 0x49, 0x7F, 0x3E, 0x00,
+    0x00, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xEC, 0x6C, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00,
+    0x00, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x06, 0x07, 0x51, 0x59, 0x0F, 0x06, 0x00,
+    0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x5F, 0x1E, 0x00, 0x00, 0x7C, 0x7E, 0x13, 0x13, 0x7E, 0x7C, 0x00,
+    0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00,
+    0x41, 0x7F, 0x7F, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00,
+    0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x51, 0x73, 0x72, 0x00,
+    0x00, 0x7F, 0x7F, 0x08, 0x08, 0x7F, 0x7F, 0x00, 0x00, 0x41, 0x41, 0x7F, 0x7F, 0x41, 0x41, 0x00,
+    0x30, 0x70, 0x40, 0x41, 0x7F, 0x3F, 0x01, 0x00, 0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63, 0x00,
+    0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70, 0x00, 0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x00,
+    0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x63, 0x3E, 0x1C, 0x00,
+    0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06, 0x00, 0x3C, 0x7E, 0x43, 0x51, 0x33, 0x6E, 0x5C, 0x00,
+    0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66, 0x00, 0x00, 0x26, 0x6F, 0x49, 0x49, 0x7B, 0x32, 0x00,
+    0x00, 0x03, 0x41, 0x7F, 0x7F, 0x41, 0x03, 0x00, 0x00, 0x3F, 0x7F, 0x40, 0x40, 0x7F, 0x3F, 0x00,
+    0x00, 0x1F, 0x3F, 0x60, 0x60, 0x3F, 0x1F, 0x00, 0x7F, 0x7F, 0x30, 0x18, 0x30, 0x7F, 0x7F, 0x00,
+    0x61, 0x73, 0x1E, 0x0C, 0x1E, 0x73, 0x61, 0x00, 0x00, 0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07, 0x00,
+    0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x41, 0x41, 0x00, 0x00,
+    0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x41, 0x41, 0x7F, 0x7F, 0x00, 0x00,
+    0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x01, 0x03, 0x06, 0x04, 0x00, 0x00, 0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40, 0x00,
+    0x41, 0x7F, 0x3F, 0x44, 0x44, 0x7C, 0x38, 0x00, 0x00, 0x38, 0x7C, 0x44, 0x44, 0x6C, 0x28, 0x00,
+    0x38, 0x7C, 0x44, 0x45, 0x3F, 0x7F, 0x40, 0x00, 0x00, 0x38, 0x7C, 0x54, 0x54, 0x5C, 0x18, 0x00,
+    0x00, 0x48, 0x7E, 0x7F, 0x49, 0x03, 0x02, 0x00, 0x00, 0x98, 0xBC, 0xA4, 0xA4, 0xFC, 0x7C, 0x00,
+    0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78, 0x00, 0x00, 0x00, 0x44, 0x7D, 0x7D, 0x40, 0x00, 0x00,
+    0x00, 0x60, 0xE0, 0x80, 0x84, 0xFD, 0x7D, 0x00, 0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44, 0x00,
+    0x00, 0x00, 0x41, 0x7F, 0x7F, 0x40, 0x00, 0x00, 0x78, 0x7C, 0x0C, 0x38, 0x0C, 0x7C, 0x78, 0x00,
+    0x04, 0x7C, 0x78, 0x04, 0x04, 0x7C, 0x78, 0x00, 0x00, 0x38, 0x7C, 0x44, 0x44, 0x7C, 0x38, 0x00,
+    0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18, 0x00, 0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84, 0x00,
+    0x44, 0x7C, 0x78, 0x4C, 0x04, 0x0C, 0x08, 0x00, 0x00, 0x48, 0x5C, 0x54, 0x54, 0x74, 0x20, 0x00,
+    0x00, 0x04, 0x3F, 0x7F, 0x44, 0x64, 0x20, 0x00, 0x00, 0x3C, 0x7C, 0x40, 0x40, 0x7C, 0x7C, 0x00,
+    0x00, 0x1C, 0x3C, 0x60, 0x60, 0x3C, 0x1C, 0x00, 0x3C, 0x7C, 0x60, 0x38, 0x60, 0x7C, 0x3C, 0x00,
+    0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x00, 0x00, 0x9C, 0xBC, 0xA0, 0xA0, 0xFC, 0x7C, 0x00,
+    0x00, 0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x00,
+    0x10, 0x18, 0x08, 0x18, 0x10, 0x18, 0x08, 0x00,
+};
+
+static const ssd1306_glyph_t ssd1306_font_8x8_glyphs[95] = {
+    {0, 8, 8}, // U+0020
+    {8, 8, 8}, // !
+    {16, 8, 8}, // "
+    {24, 8, 8}, // #
+    {32, 8, 8}, // $
+    {40, 8, 8}, // %
+    {48, 8, 8}, // &
+    {56, 8, 8}, // '
+    {64, 8, 8}, // (
+    {72, 8, 8}, // )
+    {80, 8, 8}, // *
+    {88, 8, 8}, // +
+    {96, 8, 8}, // ,
+    {104, 8, 8}, // -
+    {112, 8, 8}, // .
+    {120, 8, 8}, // /
+    {128, 8, 8}, // 0
+    {136, 8, 8}, // 1
+    {144, 8, 8}, // 2
+    {152, 8, 8}, // 3
+    {160, 8, 8}, // 4
+    {168, 8, 8}, // 5
+    {176, 8, 8}, // 6
+    {184, 8, 8}, // 7
+    {192, 8, 8}, // 8
+    {200, 8, 8}, // 9
+    {208, 8, 8}, // :
+    {216, 8, 8}, // ;
+    {224, 8, 8}, // <
+    {232, 8, 8}, // =
+    {240, 8, 8}, // >
+    {248, 8, 8}, // ?
+    {256, 8, 8}, // @
+    {264, 8, 8}, // A
+    {272, 8, 8}, // B
+    {280, 8, 8}, // C
+    {288, 8, 8}, // D
+    {296, 8, 8}, // E
+    {304, 8, 8}, // F
+    {312, 8, 8}, // G
+    {320, 8, 8}, // H
+    {328, 8, 8}, // I
+    {336, 8, 8}, // J
+    {344, 8, 8}, // K
+    {352, 8, 8}, // L
+    {360, 8, 8}, // M
+    {368, 8, 8}, // N
+    {376, 8, 8}, // O
+    {384, 8, 8}, // P
+    {392, 8, 8}, // Q
+    {400, 8, 8}, // R
+    {408, 8, 8}, // S
+    {416, 8, 8}, // T
+    {424, 8, 8}, // U
+    {432, 8, 8}, // V
+    {440, 8, 8}, // W
+    {448, 8, 8}, // X
+    {456, 8, 8}, // Y
+    {464, 8, 8}, // Z
+    {472, 8, 8}, // [
+    {480, 8, 8}, // U+005C
+    {488, 8, 8}, // ]
+    {496, 8, 8}, // ^
+    {504, 8, 8}, // _
+    {512, 8, 8}, // `
+    {520, 8, 8}, // a
+    {528, 8, 8}, // b
+    {536, 8, 8}, // c
+    {544, 8, 8}, // d
+    {552, 8, 8}, // e
+    {560, 8, 8}, // f
+    {568, 8, 8}, // g
+    {576, 8, 8}, // h
+    {584, 8, 8}, // i
+    {592, 8, 8}, // j
+    {600, 8, 8}, // k
+    {608, 8, 8}, // l
+    {616, 8, 8}, // m
+    {624, 8, 8}, // n
+    {632, 8, 8}, // o
+    {640, 8, 8}, // p
+    {648, 8, 8}, // q
+    {656, 8, 8}, // r
+    {664, 8, 8}, // s
+    {672, 8, 8}, // t
+    {680, 8, 8}, // u
+    {688, 8, 8}, // v
+    {696, 8, 8}, // w
+    {704, 8, 8}, // x
+    {712, 8, 8}, // y
+    {720, 8, 8}, // z
+    {728, 8, 8}, // {
+    {736, 8, 8}, // |
+    {744, 8, 8}, // }
+    {752, 8, 8}, // ~
+};
+
+static const ssd1306_font_range_t ssd1306_font_8x8_ranges[1] = {
+    {0x0020, 95, 0},
+};
+
+const ssd1306_font_t ssd1306_font_8x8 = {
+    .height = 8,
+    .range_count = 1,
+    .fallback = 0,
+    .ranges = ssd1306_font_8x8_ranges,
+    .glyphs = ssd1306_font_8x8_glyphs,
+    .bitmaps = ssd1306_font_8x8_bitmaps};
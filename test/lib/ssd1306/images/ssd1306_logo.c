@@ -0,0 +1,31 @@
+/* Generated by tools/ssd1306_imagegen.py from ssd1306_logo.png; do not edit. */
+
+#include "ssd1306_image.h"
+
+static const uint8_t ssd1306_logo_data[276] = {
+    0x81, 0xFF, 0x01, 0x0F, 0x0F, 0x81, 0xEF, 0x01, 0x0F, 0x0F, 0x87, 0xFF, 0x10, 0x7F, 0x3F, 0x9F,
+    0x5F, 0x6F, 0xE7, 0xF3, 0xF9, 0xF9, 0xFB, 0xF7, 0xE7, 0xCF, 0x9F, 0xBF, 0x7F, 0x7F, 0x9A, 0xFF,
+    0x01, 0x00, 0x00, 0x81, 0xFF, 0x10, 0x00, 0x00, 0x7F, 0x3F, 0x9F, 0xDF, 0xCF, 0xE7, 0xF3, 0xF9,
+    0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xC0, 0xC0, 0x88, 0xFF, 0x0A, 0xFE, 0xFC, 0xF9, 0xF3, 0xF7, 0x67,
+    0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x8E, 0xFF, 0x03, 0x7F, 0x3F, 0x80, 0xC0, 0x81, 0xFF, 0x0A, 0xFE,
+    0xFC, 0xFE, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x88, 0x01, 0x0C, 0x03, 0x03, 0x07,
+    0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFB, 0xF9, 0xFC, 0xFC, 0xFE, 0x80, 0xFF, 0x09, 0xFE, 0xFC, 0xF9,
+    0xF3, 0xF7, 0xEF, 0xCF, 0x9F, 0x3F, 0x7F, 0x84, 0xFF, 0x04, 0x00, 0xFE, 0x7F, 0x3F, 0x3F, 0x80,
+    0xFF, 0x02, 0x7F, 0x07, 0x01, 0x83, 0x00, 0x01, 0xE0, 0xE0, 0x81, 0xF0, 0x01, 0xE0, 0xE0, 0x8C,
+    0x00, 0x01, 0x01, 0x07, 0x80, 0xFF, 0x84, 0x7F, 0x06, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0x80, 0x00,
+    0x82, 0xFF, 0x04, 0xFC, 0xFC, 0xFE, 0xFE, 0x00, 0x80, 0xFF, 0x01, 0xFE, 0xE0, 0x84, 0x00, 0x01,
+    0x07, 0x07, 0x81, 0x0F, 0x01, 0x07, 0x07, 0x8C, 0x00, 0x01, 0x80, 0xE0, 0x80, 0xFF, 0x84, 0xFE,
+    0x06, 0xFF, 0xFF, 0x00, 0xFE, 0xFE, 0xFC, 0xFC, 0x86, 0xFF, 0x00, 0x00, 0x83, 0xFF, 0x04, 0xFE,
+    0xF8, 0xF0, 0xE0, 0xC0, 0x8F, 0x00, 0x08, 0x80, 0xC0, 0xE0, 0xF0, 0xFC, 0x9E, 0x1F, 0x3F, 0x7F,
+    0x88, 0xFF, 0x00, 0x00, 0x8A, 0xFF, 0x00, 0x00, 0x89, 0xFF, 0x02, 0xFE, 0xFC, 0x70, 0x87, 0x00,
+    0x02, 0x60, 0x78, 0xFC, 0x85, 0xFF, 0x02, 0xFE, 0xFE, 0xFC, 0x87, 0xFF, 0x00, 0x00, 0x8A, 0xFF,
+    0x00, 0xC0, 0x8B, 0xDF, 0x02, 0xD0, 0xC0, 0xC0, 0x84, 0xC2, 0x02, 0xC0, 0xC0, 0xD0, 0x93, 0xDF,
+    0x00, 0xC0, 0x85, 0xFF,
+};
+
+const ssd1306_image_t ssd1306_logo = {
+    .width = 64,
+    .height = 64,
+    .encoding = SSD1306_IMAGE_RLE,
+    .size = 276,
+    .data = ssd1306_logo_data};
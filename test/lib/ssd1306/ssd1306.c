@@ -1,39 +1,7 @@
+#include <esp_timer.h>
 #include "ssd1306.h"
 #include "ssd1306_const.h"
-
-uint8_t ssd1306_logo[8][64] = {
-    {0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0xEF, 0xEF, 0xEF, 0xEF, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x9F, 0x5F, 0x6F, 0xE7, 0xF3, 0xF9, 0xF9, 0xFB,
-     0xF7, 0xE7, 0xCF, 0x9F, 0xBF, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x3F, 0x9F, 0xDF,
-     0xCF, 0xE7, 0xF3, 0xF9, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF9, 0xF3, 0xF7, 0x67, 0x0F, 0x1F, 0x3F, 0x7F,
-     0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0xFF, 0x7F, 0x3F, 0x80, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0x1F,
-     0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-     0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFB, 0xF9, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF,
-     0xFE, 0xFC, 0xF9, 0xF3, 0xF7, 0xEF, 0xCF, 0x9F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0x00, 0xFE, 0x7F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F,
-     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0xFC, 0xFC, 0xFE, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-     0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0xFE, 0xFE, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xE0,
-     0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xFC, 0x9E, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFE, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-     0x78, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
-     0xDF, 0xDF, 0xDF, 0xDF, 0xD0, 0xC0, 0xC0, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0xC0,
-     0xD0, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
-     0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+#include "ssd1306_internal.h"
 
 static i2c_ssd1306_handle_t i2c_ssd1306;
 static i2c_master_bus_handle_t i2c_master_bus;
@@ -53,7 +21,125 @@ static const i2c_ssd1306_config_t i2c_ssd1306_config = {
     .i2c_scl_speed_hz = 400000,
     .width = 128,
     .height = 32,
-    .wise = SSD1306_BOTTOM_TO_TOP};
+    .wise = SSD1306_BOTTOM_TO_TOP,
+    .addressing = SSD1306_ADDRESSING_HORIZONTAL};
+
+void ssd1306_dirty_add(ssd1306_dirty_t *dirty, uint8_t initial_page, uint8_t final_page, uint8_t initial_segment, uint8_t final_segment)
+{
+    for (uint8_t page = initial_page; page <= final_page; page++)
+    {
+        uint8_t bit = 1 << page;
+        if (!(dirty->pages & bit))
+        {
+            dirty->pages |= bit;
+            dirty->start[page] = initial_segment;
+            dirty->end[page] = final_segment;
+            continue;
+        }
+        if (initial_segment < dirty->start[page])
+            dirty->start[page] = initial_segment;
+        if (final_segment > dirty->end[page])
+            dirty->end[page] = final_segment;
+    }
+}
+
+void ssd1306_dirty_copy(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *front, ssd1306_dirty_t *window)
+{
+    for (uint8_t page = 0; page < i2c_ssd1306->total_pages; page++)
+    {
+        if (!(i2c_ssd1306->dirty.pages & (1 << page)))
+            continue;
+        uint8_t start = i2c_ssd1306->dirty.start[page];
+        uint16_t offset = page * i2c_ssd1306->width + start;
+        memcpy(&front[offset], &i2c_ssd1306->framebuffer[offset], i2c_ssd1306->dirty.end[page] - start + 1);
+        ssd1306_dirty_add(window, page, page, start, i2c_ssd1306->dirty.end[page]);
+    }
+    i2c_ssd1306->dirty.pages = 0;
+}
+
+esp_err_t ssd1306_transmit(i2c_ssd1306_handle_t *i2c_ssd1306, const uint8_t *data, size_t size)
+{
+    /* A device that could not be added back at any SCL rate (see i2c_ssd1306_scl_calibrate()) has no handle. */
+    if (i2c_ssd1306->i2c_master_dev == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "No I2C SSD1306 device on the bus, recalibrate to add it again");
+        return ESP_ERR_INVALID_STATE;
+    }
+    i2c_ssd1306->flush_wire_bytes += size + 1;
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, data, size, I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
+    ssd1306_stats_transaction(i2c_ssd1306, size + 1, err, esp_timer_get_time() - start);
+
+    return err;
+}
+
+/*
+ * Send 'size' framebuffer bytes starting at 'offset' as one data transaction without copying them.
+ * The byte in front of the run (the reserved header byte for offset 0) is borrowed for the data control
+ * byte and restored afterwards, so the framebuffer must not be drawn to while a flush is running.
+ */
+static esp_err_t ssd1306_run_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *framebuffer, uint16_t offset, uint16_t size)
+{
+    uint8_t *run = &framebuffer[offset] - 1;
+    uint8_t borrowed = *run;
+    *run = OLED_CONTROL_BYTE_DATA;
+    esp_err_t err = ssd1306_transmit(i2c_ssd1306, run, size + 1);
+    *run = borrowed;
+
+    return err;
+}
+
+/*
+ * Horizontal addressing programs the column/page window once and streams the rectangle, in a single data
+ * transaction when it spans the full width. Page addressing addresses and sends every page separately.
+ */
+esp_err_t ssd1306_window_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *framebuffer, uint8_t initial_page, uint8_t final_page, uint8_t initial_segment, uint8_t final_segment)
+{
+    /* The SSD1306 forbids RAM access while a continuous scroll runs. */
+    if (i2c_ssd1306->scroll_pages)
+        return ESP_ERR_INVALID_STATE;
+
+    esp_err_t err;
+    uint16_t run_size = final_segment - initial_segment + 1;
+    if (i2c_ssd1306->addressing == SSD1306_ADDRESSING_HORIZONTAL)
+    {
+        uint8_t window_cmd[] = {
+            OLED_CONTROL_BYTE_CMD,
+            OLED_CMD_SET_COLUMN_ADDR_RANGE, initial_segment, final_segment,
+            OLED_CMD_SET_PAGE_ADDR_RANGE, initial_page, final_page};
+        err = ssd1306_transmit(i2c_ssd1306, window_cmd, sizeof(window_cmd));
+        if (err != ESP_OK)
+            return err;
+        if (run_size == i2c_ssd1306->width)
+            return ssd1306_run_to_ram(i2c_ssd1306, framebuffer, initial_page * i2c_ssd1306->width, (final_page - initial_page + 1) * run_size);
+        for (uint8_t page = initial_page; page <= final_page; page++)
+        {
+            err = ssd1306_run_to_ram(i2c_ssd1306, framebuffer, page * i2c_ssd1306->width + initial_segment, run_size);
+            if (err != ESP_OK)
+                return err;
+        }
+
+        return err;
+    }
+
+    for (uint8_t page = initial_page; page <= final_page; page++)
+    {
+        uint8_t ram_addr_cmd[] = {
+            OLED_CONTROL_BYTE_CMD,
+            OLED_MASK_PAGE_ADDR | page,
+            OLED_MASK_LSB_NIBBLE_SEG_ADDR | (initial_segment & 0x0F),
+            OLED_MASK_HSB_NIBBLE_SEG_ADDR | (initial_segment >> 4 & 0x0F)};
+        err = ssd1306_transmit(i2c_ssd1306, ram_addr_cmd, sizeof(ram_addr_cmd));
+        if (err != ESP_OK)
+            return err;
+        err = ssd1306_run_to_ram(i2c_ssd1306, framebuffer, page * i2c_ssd1306->width + initial_segment, run_size);
+        if (err != ESP_OK)
+            return err;
+    }
+
+    return ESP_OK;
+}
 
 void init_ssd1306(void)
 {
@@ -75,8 +161,14 @@ void init_ssd1306(void)
     }
     ESP_LOGI(SSD1306_TAG, "SSD1306 initialized successfully");
     
-    i2c_ssd1306_buffer_image(&i2c_ssd1306, 32, 0, (const uint8_t *)ssd1306_logo, 64, 32, false);
+    i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 32, 0, &ssd1306_logo, false);
     i2c_ssd1306_buffer_to_ram(&i2c_ssd1306);
+#ifdef CONFIG_SSD1306_SCL_CALIBRATION
+    i2c_ssd1306_scl_calibration_config_t calibration_config = I2C_SSD1306_SCL_CALIBRATION_CONFIG_DEFAULT();
+    ret = i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, NULL);
+    if (ret != ESP_OK)
+        ESP_LOGW(SSD1306_TAG, "SCL calibration failed, keeping %lu Hz: %s", (unsigned long)i2c_ssd1306.i2c_scl_speed_hz, esp_err_to_name(ret));
+#endif
     vTaskDelay(1000 / portTICK_PERIOD_MS);
     i2c_ssd1306_buffer_clear(&i2c_ssd1306);
 }
@@ -86,28 +178,61 @@ i2c_master_bus_handle_t get_i2c_bus_handle(void)
     return i2c_master_bus;
 }
 
+i2c_ssd1306_handle_t *get_ssd1306_handle(void)
+{
+    return &i2c_ssd1306;
+}
+
 esp_err_t ssd1306_buffer_clear(void)
 {
     return i2c_ssd1306_buffer_clear(&i2c_ssd1306);
 }
 
+esp_err_t ssd1306_fill_space(uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill)
+{
+    return i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, x1, x2, y1, y2, fill);
+}
+
 esp_err_t ssd1306_print_str(uint8_t x, uint8_t y, const char *text, bool invert)
 {
     return (i2c_ssd1306_buffer_text(&i2c_ssd1306, x, y, text, invert));
 }
 
+esp_err_t init_ssd1306_async(void)
+{
+    i2c_ssd1306_async_config_t async_config = I2C_SSD1306_ASYNC_CONFIG_DEFAULT();
+
+    return i2c_ssd1306_async_start(&i2c_ssd1306, &async_config);
+}
+
 esp_err_t ssd1306_display(void)
 {
-    return (i2c_ssd1306_buffer_to_ram(&i2c_ssd1306));
+    if (i2c_ssd1306.async)
+        return i2c_ssd1306_present(&i2c_ssd1306);
+
+    esp_err_t err = i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+    ESP_LOGD(SSD1306_TAG, "Flushed %lu bytes", (unsigned long)i2c_ssd1306.flush_wire_bytes);
+
+    return err;
 }
 
 esp_err_t i2c_ssd1306_init(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_config_t i2c_ssd1306_config, i2c_ssd1306_handle_t *i2c_ssd1306)
 {
-    if (i2c_ssd1306_config.i2c_scl_speed_hz > 400000 || i2c_ssd1306_config.width > 128 || i2c_ssd1306_config.height % 8 != 0 || i2c_ssd1306_config.height < 16 || i2c_ssd1306_config.height > 64)
+    if (i2c_ssd1306_config.i2c_scl_speed_hz > 400000 || i2c_ssd1306_config.width > SSD1306_MAX_WIDTH || i2c_ssd1306_config.height % 8 != 0 || i2c_ssd1306_config.height < 16 || i2c_ssd1306_config.height > SSD1306_MAX_PAGES * 8)
     {
         ESP_LOGE(SSD1306_TAG, "Invalid SSD1306 configuration, 'i2c_scl_speed_hz' must be less than or equal to 400000, 'width' must be less than or equal to 128, 'height' must be between 16 and 64 and multiple of 8");
         return ESP_ERR_INVALID_ARG;
     }
+    if (((uintptr_t)i2c_ssd1306_config.framebuffer & (sizeof(uint32_t) - 1)) != 0)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid SSD1306 framebuffer, 'framebuffer' must be aligned to 4 bytes");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (i2c_ssd1306_config.framebuffer == NULL && SSD1306_FRAMEBUFFER_SIZE(i2c_ssd1306_config.width, i2c_ssd1306_config.height) > SSD1306_EMBEDDED_FRAMEBUFFER_SIZE)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid SSD1306 framebuffer, the embedded storage holds %d bytes, supply 'framebuffer' for a %dx%d panel", SSD1306_EMBEDDED_FRAMEBUFFER_SIZE, i2c_ssd1306_config.width, i2c_ssd1306_config.height);
+        return ESP_ERR_INVALID_ARG;
+    }
 
     ESP_LOGI(SSD1306_TAG, "Initializing I2C SSD1306...");
     esp_err_t ret = i2c_master_probe(i2c_master_bus, i2c_ssd1306_config.i2c_device_address, I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
@@ -153,11 +278,12 @@ esp_err_t i2c_ssd1306_init(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_c
         OLED_CMD_COM_SCAN_DIRECTION_NORMAL,
         OLED_CMD_SEGMENT_REMAP_LEFT_TO_RIGHT,
         OLED_CMD_SET_COM_PIN_HARDWARE_MAP, com_pins,
-        OLED_CMD_SET_MEMORY_ADDR_MODE, 0x02,
+        OLED_CMD_SET_MEMORY_ADDR_MODE, (i2c_ssd1306_config.addressing == SSD1306_ADDRESSING_HORIZONTAL) ? 0x00 : 0x02,
         OLED_CMD_SET_CONTRAST_CONTROL, 0xFF,
         OLED_CMD_SET_DISPLAY_CLK_DIVIDE, 0x80,
         OLED_CMD_ENABLE_DISPLAY_RAM,
         OLED_CMD_NORMAL_DISPLAY,
+        OLED_CMD_DEACTIVATE_SCROLL,
         OLED_CMD_SET_CHARGE_PUMP, 0x14,
         OLED_CMD_DISPLAY_ON};
     if (i2c_ssd1306_config.wise == SSD1306_BOTTOM_TO_TOP)
@@ -172,22 +298,32 @@ esp_err_t i2c_ssd1306_init(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_c
         return ret;
     }
 
+    i2c_ssd1306->i2c_device_address = i2c_ssd1306_config.i2c_device_address;
+    i2c_ssd1306->i2c_scl_speed_hz = i2c_ssd1306_config.i2c_scl_speed_hz;
     i2c_ssd1306->width = i2c_ssd1306_config.width;
     i2c_ssd1306->height = i2c_ssd1306_config.height;
     i2c_ssd1306->total_pages = i2c_ssd1306_config.height / 8;
-
-    i2c_ssd1306->page = (ssd1306_page_t *)calloc(i2c_ssd1306->total_pages, sizeof(ssd1306_page_t));
-    if (i2c_ssd1306->page == NULL)
-    {
-        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for I2C SSD1306 device");
-        return ESP_ERR_NO_MEM;
-    }
-    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
-    {
-        i2c_ssd1306->page[i].segment = (uint8_t *)calloc(i2c_ssd1306->width, sizeof(uint8_t));
-        if (i2c_ssd1306->page[i].segment == NULL)
-            return ESP_ERR_NO_MEM;
-    }
+    i2c_ssd1306->addressing = i2c_ssd1306_config.addressing;
+#if SSD1306_EMBEDDED_FRAMEBUFFER_SIZE > 0
+    uint8_t *framebuffer = i2c_ssd1306_config.framebuffer ? i2c_ssd1306_config.framebuffer : (uint8_t *)i2c_ssd1306->framebuffer_storage;
+#else
+    uint8_t *framebuffer = i2c_ssd1306_config.framebuffer;
+#endif
+    i2c_ssd1306->framebuffer = framebuffer + SSD1306_FRAMEBUFFER_HEADER;
+    i2c_ssd1306->framebuffer[-1] = OLED_CONTROL_BYTE_DATA;
+    memset(i2c_ssd1306->framebuffer, 0x00, SSD1306_FRAMEBUFFER_SIZE(i2c_ssd1306->width, i2c_ssd1306->height) - SSD1306_FRAMEBUFFER_HEADER);
+    /* The display RAM content is undefined after power-up, so the first dirty flush must send everything. */
+    i2c_ssd1306->dirty.pages = 0;
+    ssd1306_mark_all_dirty(i2c_ssd1306);
+    i2c_ssd1306->flush_wire_bytes = 0;
+    memset(&i2c_ssd1306->stats, 0, sizeof(i2c_ssd1306->stats));
+    i2c_ssd1306->async = NULL;
+    i2c_ssd1306->scheduler = NULL;
+    i2c_ssd1306->gray = NULL;
+    i2c_ssd1306->console = NULL;
+    i2c_ssd1306->scroll_pages = 0;
+    i2c_ssd1306->scroll_fixed_rows = 0;
+    i2c_ssd1306->scroll_rows = i2c_ssd1306->height;
     ESP_LOGI(SSD1306_TAG, "I2C SSD1306 initialized successfully");
 
     return ret;
@@ -196,17 +332,23 @@ esp_err_t i2c_ssd1306_init(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_c
 esp_err_t i2c_ssd1306_deinit(i2c_ssd1306_handle_t *i2c_ssd1306)
 {
     ESP_LOGI(SSD1306_TAG, "Deinitializing I2C SSD1306...");
-    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
-    {
-        free(i2c_ssd1306->page[i].segment);
-    }
-    free(i2c_ssd1306->page);
-    esp_err_t ret = i2c_master_bus_rm_device(i2c_ssd1306->i2c_master_dev);
+    if (i2c_ssd1306->async)
+        i2c_ssd1306_async_stop(i2c_ssd1306);
+    if (i2c_ssd1306->scheduler)
+        i2c_ssd1306_scheduler_remove(i2c_ssd1306);
+    if (i2c_ssd1306->gray)
+        i2c_ssd1306_gray_stop(i2c_ssd1306);
+    if (i2c_ssd1306->console)
+        i2c_ssd1306_console_stop(i2c_ssd1306);
+    esp_err_t ret = ESP_OK;
+    if (i2c_ssd1306->i2c_master_dev != NULL)
+        ret = i2c_master_bus_rm_device(i2c_ssd1306->i2c_master_dev);
     if (ret != ESP_OK)
     {
         ESP_LOGE(SSD1306_TAG, "Failed to remove I2C SSD1306 device");
         return ret;
     }
+    i2c_ssd1306->i2c_master_dev = NULL;
     ESP_LOGI(SSD1306_TAG, "I2C SSD1306 deinitialized successfully");
 
     return ret;
@@ -216,9 +358,10 @@ esp_err_t i2c_ssd1306_buffer_check(i2c_ssd1306_handle_t *i2c_ssd1306)
 {
     for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
     {
+        const uint8_t *segment = ssd1306_page(i2c_ssd1306, i);
         for (uint8_t j = 0; j < i2c_ssd1306->width; j++)
         {
-            printf("%02X ", i2c_ssd1306->page[i].segment[j]);
+            printf("%02X ", segment[j]);
         }
         printf("\n");
     }
@@ -226,24 +369,22 @@ esp_err_t i2c_ssd1306_buffer_check(i2c_ssd1306_handle_t *i2c_ssd1306)
     return ESP_OK;
 }
 
-esp_err_t i2c_ssd1306_buffer_clear(i2c_ssd1306_handle_t *i2c_ssd1306)
+SSD1306_ALWAYS_INLINE esp_err_t ssd1306_buffer_set(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, uint8_t value)
 {
-    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
-    {
-        memset(i2c_ssd1306->page[i].segment, 0x00, i2c_ssd1306->width);
-    }
+    memset(i2c_ssd1306->framebuffer, value, width * (height / 8));
+    ssd1306_dirty_add(&i2c_ssd1306->dirty, 0, height / 8 - 1, 0, width - 1);
 
     return ESP_OK;
 }
 
-esp_err_t i2c_ssd1306_buffer_fill(i2c_ssd1306_handle_t *i2c_ssd1306)
+esp_err_t i2c_ssd1306_buffer_clear(i2c_ssd1306_handle_t *i2c_ssd1306)
 {
-    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
-    {
-        memset(i2c_ssd1306->page[i].segment, 0xFF, i2c_ssd1306->width);
-    }
+    return SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_buffer_set, 0x00);
+}
 
-    return ESP_OK;
+esp_err_t i2c_ssd1306_buffer_fill(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    return SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_buffer_set, 0xFF);
 }
 
 esp_err_t i2c_ssd1306_buffer_fill_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, bool fill)
@@ -253,28 +394,23 @@ esp_err_t i2c_ssd1306_buffer_fill_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8
         ESP_LOGE(SSD1306_TAG, "Invalid pixel coordinates, 'x' must be between 0 and %d, 'y' must be between 0 and %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
         return ESP_ERR_INVALID_ARG;
     }
-    uint8_t page = y / 8;
+    uint8_t *segment = &ssd1306_page(i2c_ssd1306, y / 8)[x];
     uint8_t bit = 1 << (y % 8);
     if (fill)
     {
-        i2c_ssd1306->page[page].segment[x] |= bit;
+        *segment |= bit;
     }
     else
     {
-        i2c_ssd1306->page[page].segment[x] &= ~bit;
+        *segment &= ~bit;
     }
+    ssd1306_mark_dirty(i2c_ssd1306, y / 8, y / 8, x, x);
 
     return ESP_OK;
 }
 
-esp_err_t i2c_ssd1306_buffer_fill_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill)
+void ssd1306_fill_rect(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill)
 {
-    if (x1 >= i2c_ssd1306->width || x2 >= i2c_ssd1306->width || y1 >= i2c_ssd1306->height || y2 >= i2c_ssd1306->height || x1 > x2 || y1 > y2)
-    {
-        ESP_LOGE(SSD1306_TAG, "Invalid space coordinates, 'x1' and 'x2' must be between 0 and %d, 'y1' and 'y2' must be between 0 and %d, 'x1' must be less than 'x2', 'y1' must be less than 'y2'", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
-        return ESP_ERR_INVALID_ARG;
-    }
-
     uint8_t start_page = y1 / 8;
     uint8_t end_page = y2 / 8;
     uint8_t mask;
@@ -300,35 +436,109 @@ esp_err_t i2c_ssd1306_buffer_fill_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8
             mask = 0xFF;
         }
 
+        uint8_t *segment = ssd1306_page(i2c_ssd1306, page);
         for (uint8_t j = x1; j <= x2; j++)
         {
             if (fill)
-                i2c_ssd1306->page[page].segment[j] |= mask;
+                segment[j] |= mask;
             else
-                i2c_ssd1306->page[page].segment[j] &= ~mask;
+                segment[j] &= ~mask;
         }
     }
+}
+
+esp_err_t i2c_ssd1306_buffer_fill_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill)
+{
+    if (x1 >= i2c_ssd1306->width || x2 >= i2c_ssd1306->width || y1 >= i2c_ssd1306->height || y2 >= i2c_ssd1306->height || x1 > x2 || y1 > y2)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid space coordinates, 'x1' and 'x2' must be between 0 and %d, 'y1' and 'y2' must be between 0 and %d, 'x1' must be less than 'x2', 'y1' must be less than 'y2'", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_fill_rect(i2c_ssd1306, x1, x2, y1, y2, fill);
+    ssd1306_mark_dirty(i2c_ssd1306, y1 / 8, y2 / 8, x1, x2);
 
     return ESP_OK;
 }
 
 esp_err_t i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, bool invert)
 {
-    if (x >= i2c_ssd1306->width || y >= i2c_ssd1306->height || !text || strlen(text) == 0)
+    return i2c_ssd1306_buffer_text_rop(i2c_ssd1306, x, y, text, invert, SSD1306_ROP_OR);
+}
+
+/*
+ * Blit 'columns' source bytes into the page row 'lower' and, when 'upper' is not NULL, into the row below it.
+ * Each byte is shifted down by 'offset' rows: the shifted low part lands in 'lower' and the carried-out high part
+ * in 'upper', while the destination bits outside the source band are kept through 'lower_keep'/'upper_keep'.
+ * When the rows and the source are 4-byte aligned, four columns go per 32-bit word; the shift is done across all
+ * lanes at once and the bits crossing into the neighbouring lane are masked off.
+ */
+SSD1306_ALWAYS_INLINE void ssd1306_blit_run(uint8_t *lower, uint8_t *upper, const uint8_t *src, uint16_t columns, uint8_t offset, uint8_t invert_mask, uint8_t lower_keep, uint8_t upper_keep)
+{
+    uint16_t j = 0;
+    if ((((uintptr_t)lower | (uintptr_t)upper | (uintptr_t)src) & 3) == 0)
+    {
+        uint32_t invert_lanes = SSD1306_LANES(invert_mask);
+        uint32_t lower_band = SSD1306_LANES(0xFF << offset);
+        uint32_t lower_keep_lanes = SSD1306_LANES(lower_keep);
+        if (upper == NULL)
+        {
+            for (; j + 4 <= columns; j += 4)
+            {
+                uint32_t word = *(const ssd1306_word_t *)&src[j] ^ invert_lanes;
+                ssd1306_word_t *dst = (ssd1306_word_t *)&lower[j];
+                *dst = (*dst & lower_keep_lanes) | ((word << offset) & lower_band);
+            }
+        }
+        else
+        {
+            uint32_t upper_band = SSD1306_LANES(0xFF >> (8 - offset));
+            uint32_t upper_keep_lanes = SSD1306_LANES(upper_keep);
+            for (; j + 4 <= columns; j += 4)
+            {
+                uint32_t word = *(const ssd1306_word_t *)&src[j] ^ invert_lanes;
+                ssd1306_word_t *dst_lower = (ssd1306_word_t *)&lower[j];
+                ssd1306_word_t *dst_upper = (ssd1306_word_t *)&upper[j];
+                *dst_lower = (*dst_lower & lower_keep_lanes) | ((word << offset) & lower_band);
+                *dst_upper = (*dst_upper & upper_keep_lanes) | ((word >> (8 - offset)) & upper_band);
+            }
+        }
+    }
+    for (; j < columns; j++)
+    {
+        uint16_t shifted = (uint16_t)(src[j] ^ invert_mask) << offset;
+        lower[j] = (lower[j] & lower_keep) | (uint8_t)shifted;
+        if (upper)
+            upper[j] = (upper[j] & upper_keep) | (uint8_t)(shifted >> 8);
+    }
+}
+
+SSD1306_ALWAYS_INLINE esp_err_t ssd1306_text_rop(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, uint8_t x, uint8_t y, const char *text, bool invert, ssd1306_rop_t rop)
+{
+    if (x >= width || y >= height || !text || text[0] == '\0')
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid text or coordinates: x=%d (max %d), y=%d (max %d)", x, width - 1, y, height - 1);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (rop != SSD1306_ROP_OR && rop != SSD1306_ROP_COPY)
     {
-        ESP_LOGE(SSD1306_TAG, "Invalid text or coordinates: x=%d (max %d), y=%d (max %d)", x, i2c_ssd1306->width - 1, y, i2c_ssd1306->height - 1);
+        ESP_LOGE(SSD1306_TAG, "Invalid raster operation for text, only SSD1306_ROP_OR and SSD1306_ROP_COPY are supported");
         return ESP_ERR_INVALID_ARG;
     }
 
-    uint8_t len = strlen(text);
+    size_t len = strlen(text);
     uint8_t page = y / 8;
     uint8_t offset = y % 8;
-    bool has_next_page = (page + 1) < i2c_ssd1306->total_pages;
+    bool has_next_page = (page + 1) < height / 8;
 
-    uint8_t max_chars = (i2c_ssd1306->width - x) / 8;
-    if (len > max_chars)
+    uint16_t columns = width - x;
+    if (len * 8 > columns)
     {
-        ESP_LOGW(SSD1306_TAG, "Text truncated: text columns exceed display width, lost %d columns", x + (len * 8) - i2c_ssd1306->width);
+        ESP_LOGW(SSD1306_TAG, "Text truncated: text columns exceed display width, lost %d columns", (int)(len * 8 - columns));
+    }
+    else
+    {
+        columns = len * 8;
     }
 
     if (offset != 0 && !has_next_page)
@@ -336,44 +546,113 @@ esp_err_t i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x,
         ESP_LOGW(SSD1306_TAG, "Vertical truncation: text exceeds display height, lost %d rows", offset);
     }
 
-    for (uint8_t i = 0; i < len && x < i2c_ssd1306->width; i++)
+    /* OR keeps every destination bit; COPY keeps only the bits outside the 8-row glyph band. */
+    uint8_t band = 0xFF << offset;
+    uint8_t lower_keep = (rop == SSD1306_ROP_COPY) ? (uint8_t)~band : 0xFF;
+    uint8_t upper_keep = (rop == SSD1306_ROP_COPY) ? band : 0xFF;
+    uint8_t invert_mask = invert ? 0xFF : 0x00;
+    uint8_t *lower = &i2c_ssd1306->framebuffer[page * width + x];
+    uint8_t *upper = (offset != 0 && has_next_page) ? lower + width : NULL;
+    /* Every glyph of ssd1306_font_8x8 is a single 8-column strip; bytes it does not cover map to its blank fallback. */
+    const ssd1306_font_t *font = &ssd1306_font_8x8;
+    for (uint16_t column = 0; column < columns; column += 8)
     {
-        const uint8_t *char_data = font8x8[(uint8_t)text[i]];
-        uint8_t available_columns = i2c_ssd1306->width - x;
-        uint8_t columns_to_draw = (available_columns < 8) ? available_columns : 8;
+        uint16_t run = (columns - column < 8) ? columns - column : 8;
+        const uint8_t *glyph = &font->bitmaps[ssd1306_font_glyph(font, (uint8_t)text[column / 8])->offset];
+        ssd1306_blit_run(lower + column, upper ? upper + column : NULL, glyph, run, offset, invert_mask, lower_keep, upper_keep);
+    }
+    ssd1306_mark_dirty(i2c_ssd1306, page, upper ? page + 1 : page, x, x + columns - 1);
 
-        for (uint8_t j = 0; j < columns_to_draw; j++)
-        {
-            uint8_t char_col = char_data[j];
+    return ESP_OK;
+}
 
-            if (invert)
-            {
-                char_col = ~char_col;
-            }
+esp_err_t i2c_ssd1306_buffer_text_rop(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, bool invert, ssd1306_rop_t rop)
+{
+    return SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_text_rop, x, y, text, invert, rop);
+}
 
-            if (offset == 0)
-            {
-                i2c_ssd1306->page[page].segment[x + j] |= char_col;
-            }
-            else
+/* Body of i2c_ssd1306_buffer_text_font() for validated arguments. */
+SSD1306_ALWAYS_INLINE void ssd1306_text_font_draw(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop)
+{
+    static const uint8_t blank[8] __attribute__((aligned(4))) = {0};
+    uint8_t page = y / 8;
+    uint8_t offset = y % 8;
+    uint8_t num_pages = height / 8;
+    uint8_t strips = font->height / 8;
+    if (page + strips + (offset ? 1 : 0) > num_pages)
+    {
+        ESP_LOGW(SSD1306_TAG, "Vertical truncation: text exceeds display height, lost %d rows", y + font->height - height);
+        strips = num_pages - page;
+    }
+
+    /* Same band masks as ssd1306_text_rop(); strip n+1 fills the band strip n leaves in the page they share. */
+    uint8_t band = 0xFF << offset;
+    uint8_t lower_keep = (rop == SSD1306_ROP_COPY) ? (uint8_t)~band : 0xFF;
+    uint8_t upper_keep = (rop == SSD1306_ROP_COPY) ? band : 0xFF;
+    uint8_t invert_mask = invert ? 0xFF : 0x00;
+    bool fill_gaps = invert || rop == SSD1306_ROP_COPY;
+    uint16_t pen = x;
+    while (*text && pen < width)
+    {
+        const ssd1306_glyph_t *glyph = ssd1306_font_glyph(font, ssd1306_utf8_next(&text));
+        uint16_t room = width - pen;
+        uint16_t ink = (glyph->width < room) ? glyph->width : room;
+        uint16_t cell = (glyph->advance > glyph->width) ? glyph->advance : glyph->width;
+        cell = (cell < room) ? cell : room;
+        for (uint8_t strip = 0; strip < strips; strip++)
+        {
+            uint8_t target_page = page + strip;
+            uint8_t *lower = &i2c_ssd1306->framebuffer[target_page * width + pen];
+            uint8_t *upper = (offset != 0 && target_page + 1 < num_pages) ? lower + width : NULL;
+            ssd1306_blit_run(lower, upper, &font->bitmaps[glyph->offset + strip * glyph->width], ink, offset, invert_mask, lower_keep, upper_keep);
+            for (uint16_t column = ink; fill_gaps && column < cell; column += sizeof(blank))
             {
-                uint8_t lower_part = char_col << offset;
-                uint8_t upper_part = char_col >> (8 - offset);
-
-                i2c_ssd1306->page[page].segment[x + j] |= lower_part;
-                if (has_next_page)
-                {
-                    i2c_ssd1306->page[page + 1].segment[x + j] |= upper_part;
-                }
+                uint16_t run = cell - column;
+                if (run > sizeof(blank))
+                    run = sizeof(blank);
+                ssd1306_blit_run(lower + column, upper ? upper + column : NULL, blank, run, offset, invert_mask, lower_keep, upper_keep);
             }
         }
+        pen += glyph->advance;
+    }
+    if (*text)
+    {
+        ESP_LOGW(SSD1306_TAG, "Text truncated: text exceeds display width, lost %d columns", ssd1306_font_text_width(font, text));
+    }
 
-        x += 8;
+    uint8_t final_page = page + strips - ((offset == 0 || page + strips >= num_pages) ? 1 : 0);
+    uint16_t end = (pen < width) ? pen : width;
+    if (end > x)
+        ssd1306_mark_dirty(i2c_ssd1306, page, final_page, x, end - 1);
+}
+
+SSD1306_ALWAYS_INLINE esp_err_t ssd1306_text_font(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop)
+{
+    if (x >= width || y >= height || !text || text[0] == '\0' || !font)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid text, font or coordinates: x=%d (max %d), y=%d (max %d)", x, width - 1, y, height - 1);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (rop != SSD1306_ROP_OR && rop != SSD1306_ROP_COPY)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid raster operation for text, only SSD1306_ROP_OR and SSD1306_ROP_COPY are supported");
+        return ESP_ERR_INVALID_ARG;
     }
+    ssd1306_text_font_draw(i2c_ssd1306, width, height, x, y, text, font, invert, rop);
 
     return ESP_OK;
 }
 
+void ssd1306_draw_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop)
+{
+    SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_text_font_draw, x, y, text, font, invert, rop);
+}
+
+esp_err_t i2c_ssd1306_buffer_text_font(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop)
+{
+    return SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_text_font, x, y, text, font, invert, rop);
+}
+
 esp_err_t i2c_ssd1306_buffer_int(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, int value, bool invert)
 {
     char text[16];
@@ -390,20 +669,20 @@ esp_err_t i2c_ssd1306_buffer_float(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x,
     return i2c_ssd1306_buffer_text(i2c_ssd1306, x, y, text, invert);
 }
 
-esp_err_t i2c_ssd1306_buffer_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const uint8_t *image, uint8_t img_width, uint8_t img_height, bool invert)
+SSD1306_ALWAYS_INLINE esp_err_t ssd1306_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, uint8_t x, uint8_t y, const uint8_t *image, uint8_t img_width, uint8_t img_height, bool invert)
 {
-    if (image == NULL || img_width == 0 || img_height == 0 || x >= i2c_ssd1306->width || y >= i2c_ssd1306->height)
+    if (image == NULL || img_width == 0 || img_height == 0 || x >= width || y >= height)
     {
-        ESP_LOGE(SSD1306_TAG, "Invalid image or coordinates: x=%d (max %d), y=%d (max %d)", x, i2c_ssd1306->width - 1, y, i2c_ssd1306->height - 1);
+        ESP_LOGE(SSD1306_TAG, "Invalid image or coordinates: x=%d (max %d), y=%d (max %d)", x, width - 1, y, height - 1);
         return ESP_ERR_INVALID_ARG;
     }
 
-    uint8_t draw_width = (img_width < (i2c_ssd1306->width - x)) ? img_width : (i2c_ssd1306->width - x);
-    uint8_t draw_height = (img_height < (i2c_ssd1306->height - y)) ? img_height : (i2c_ssd1306->height - y);
+    uint8_t draw_width = (img_width < (width - x)) ? img_width : (width - x);
+    uint8_t draw_height = (img_height < (height - y)) ? img_height : (height - y);
 
     uint8_t start_page = y / 8;
     uint8_t vertical_offset = y % 8;
-    uint8_t num_pages = i2c_ssd1306->total_pages;
+    uint8_t num_pages = height / 8;
     uint8_t draw_pages = (((draw_height + 7) / 8) < (num_pages - start_page)) ? ((draw_height + 7) / 8) : (num_pages - start_page);
 
     if (img_height > draw_height)
@@ -415,39 +694,139 @@ esp_err_t i2c_ssd1306_buffer_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x,
         ESP_LOGW(SSD1306_TAG, "Horizontal truncation: Lost %d columns", img_width - draw_width);
     }
 
-    for (uint8_t col = 0; col < draw_width; col++)
+    /* Page rows of the image are blitted one after the other, so source and destination are read sequentially. */
+    for (uint8_t page = 0; page < draw_pages; page++)
     {
-        for (uint8_t page = 0; page < draw_pages; page++)
-        {
-            uint8_t target_page = start_page + page;
-            if (target_page >= num_pages)
-                break;
+        uint8_t target_page = start_page + page;
+        uint8_t *lower = &i2c_ssd1306->framebuffer[target_page * width + x];
+        uint8_t *upper = (vertical_offset != 0 && target_page + 1 < num_pages) ? lower + width : NULL;
+        ssd1306_blit_run(lower, upper, &image[page * img_width], draw_width, vertical_offset, invert ? 0xFF : 0x00, 0xFF, 0xFF);
+    }
+    uint8_t final_page = start_page + draw_pages - ((vertical_offset == 0 || start_page + draw_pages >= num_pages) ? 1 : 0);
+    ssd1306_mark_dirty(i2c_ssd1306, start_page, final_page, x, x + draw_width - 1);
 
-            uint8_t img_byte = image[page * img_width + col];
-            if (invert)
-                img_byte = ~img_byte;
+    return ESP_OK;
+}
 
-            if (vertical_offset == 0)
-            {
-                i2c_ssd1306->page[target_page].segment[x + col] |= img_byte;
-            }
-            else
-            {
-                uint8_t lower = img_byte << vertical_offset;
-                uint8_t upper = img_byte >> (8 - vertical_offset);
-
-                i2c_ssd1306->page[target_page].segment[x + col] |= lower;
-                if (target_page + 1 < num_pages)
-                {
-                    i2c_ssd1306->page[target_page + 1].segment[x + col] |= upper;
-                }
-            }
+esp_err_t i2c_ssd1306_buffer_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const uint8_t *image, uint8_t img_width, uint8_t img_height, bool invert)
+{
+    return SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_image, x, y, image, img_width, img_height, invert);
+}
+
+SSD1306_ALWAYS_INLINE uint8_t ssd1306_rop_apply(uint8_t dst, uint8_t src, uint8_t area, ssd1306_rop_t rop)
+{
+    switch (rop)
+    {
+    case SSD1306_ROP_AND_NOT:
+        return dst & ~src;
+    case SSD1306_ROP_XOR:
+        return dst ^ src;
+    case SSD1306_ROP_COPY:
+        return (dst & ~area) | src;
+    default:
+        return dst | src;
+    }
+}
+
+/*
+ * Combine 'columns' sprite bytes, limited to 'mask' (or the whole box) and 'row_mask', with the page row 'lower'
+ * and the row 'upper' below it after shifting them down by 'shift' rows. Either row is NULL when it lies outside
+ * of the panel. 'rop' is a constant at every call, so each inlined copy reduces to a single operation.
+ */
+SSD1306_ALWAYS_INLINE void ssd1306_sprite_run(uint8_t *lower, uint8_t *upper, const uint8_t *bitmap, const uint8_t *mask, uint8_t row_mask, uint16_t columns, uint8_t shift, ssd1306_rop_t rop)
+{
+    for (uint16_t j = 0; j < columns; j++)
+    {
+        uint8_t area = mask ? (mask[j] & row_mask) : row_mask;
+        uint16_t src = (uint16_t)(bitmap[j] & area) << shift;
+        uint16_t shifted_area = (uint16_t)area << shift;
+        if (lower)
+            lower[j] = ssd1306_rop_apply(lower[j], (uint8_t)src, (uint8_t)shifted_area, rop);
+        if (upper)
+            upper[j] = ssd1306_rop_apply(upper[j], (uint8_t)(src >> 8), (uint8_t)(shifted_area >> 8), rop);
+    }
+}
+
+/* One copy of the run per destination rows present, so the inner loop tests neither row. */
+SSD1306_ALWAYS_INLINE void ssd1306_sprite_strip(uint8_t *lower, uint8_t *upper, const uint8_t *bitmap, const uint8_t *mask, uint8_t row_mask, uint16_t columns, uint8_t shift, ssd1306_rop_t rop)
+{
+    if (lower && upper)
+        ssd1306_sprite_run(lower, upper, bitmap, mask, row_mask, columns, shift, rop);
+    else if (lower)
+        ssd1306_sprite_run(lower, NULL, bitmap, mask, row_mask, columns, shift, rop);
+    else
+        ssd1306_sprite_run(NULL, upper, bitmap, mask, row_mask, columns, shift, rop);
+}
+
+/* Body of i2c_ssd1306_buffer_sprite() for a validated sprite. */
+SSD1306_ALWAYS_INLINE void ssd1306_sprite_draw(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop)
+{
+    int32_t first_column = (x < 0) ? -x : 0;
+    int32_t end_column = (x + sprite->width < width) ? sprite->width : width - x;
+    if (first_column >= end_column || y + sprite->height <= 0 || y >= height)
+        return;
+
+    /* Page row of the sprite's top row, rounded down for a negative 'y', and the sub-byte shift shared by every strip. */
+    int32_t first_page = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    uint8_t shift = y - first_page * 8;
+    uint8_t num_pages = height / 8;
+    uint8_t sprite_pages = (sprite->height + 7) / 8;
+    uint16_t columns = end_column - first_column;
+    for (uint8_t strip = 0; strip < sprite_pages && first_page + strip < num_pages; strip++)
+    {
+        int32_t target_page = first_page + strip;
+        uint8_t *lower = (target_page >= 0) ? &i2c_ssd1306->framebuffer[target_page * width + x + first_column] : NULL;
+        uint8_t *upper = (shift != 0 && target_page + 1 >= 0 && target_page + 1 < num_pages) ? &i2c_ssd1306->framebuffer[(target_page + 1) * width + x + first_column] : NULL;
+        if (lower == NULL && upper == NULL)
+            continue;
+
+        uint8_t row_mask = (strip == sprite_pages - 1 && sprite->height % 8) ? 0xFF >> (8 - sprite->height % 8) : 0xFF;
+        const uint8_t *bitmap = &sprite->bitmap[strip * sprite->width + first_column];
+        const uint8_t *mask = sprite->mask ? &sprite->mask[strip * sprite->width + first_column] : NULL;
+        switch (rop)
+        {
+        case SSD1306_ROP_AND_NOT:
+            ssd1306_sprite_strip(lower, upper, bitmap, mask, row_mask, columns, shift, SSD1306_ROP_AND_NOT);
+            break;
+        case SSD1306_ROP_XOR:
+            ssd1306_sprite_strip(lower, upper, bitmap, mask, row_mask, columns, shift, SSD1306_ROP_XOR);
+            break;
+        case SSD1306_ROP_COPY:
+            ssd1306_sprite_strip(lower, upper, bitmap, mask, row_mask, columns, shift, SSD1306_ROP_COPY);
+            break;
+        default:
+            ssd1306_sprite_strip(lower, upper, bitmap, mask, row_mask, columns, shift, SSD1306_ROP_OR);
+            break;
         }
     }
 
+    int32_t top = (y < 0) ? 0 : y;
+    int32_t bottom = (y + sprite->height < height) ? y + sprite->height - 1 : height - 1;
+    ssd1306_mark_dirty(i2c_ssd1306, top / 8, bottom / 8, x + first_column, x + end_column - 1);
+}
+
+SSD1306_ALWAYS_INLINE esp_err_t ssd1306_sprite(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop)
+{
+    if (sprite == NULL || sprite->bitmap == NULL || sprite->width == 0 || sprite->height == 0)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid sprite, it must have a bitmap and a non-zero size");
+        return ESP_ERR_INVALID_ARG;
+    }
+    ssd1306_sprite_draw(i2c_ssd1306, width, height, x, y, sprite, rop);
+
     return ESP_OK;
 }
 
+void ssd1306_draw_sprite(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop)
+{
+    SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_sprite_draw, x, y, sprite, rop);
+}
+
+esp_err_t i2c_ssd1306_buffer_sprite(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop)
+{
+    return SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_sprite, x, y, sprite, rop);
+}
+
 esp_err_t i2c_ssd1306_segment_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t segment)
 {
     if (page >= i2c_ssd1306->total_pages || segment >= i2c_ssd1306->width)
@@ -456,21 +835,7 @@ esp_err_t i2c_ssd1306_segment_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t
         return ESP_ERR_INVALID_ARG;
     }
 
-    uint8_t ram_addr_cmd[] = {
-        OLED_CONTROL_BYTE_CMD,
-        OLED_MASK_PAGE_ADDR | page,
-        OLED_MASK_LSB_NIBBLE_SEG_ADDR | (segment & 0x0F),
-        OLED_MASK_HSB_NIBBLE_SEG_ADDR | (segment >> 4 & 0x0F)};
-    esp_err_t err = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_addr_cmd, sizeof(ram_addr_cmd), I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
-    if (err != ESP_OK)
-    {
-        ESP_LOGE(SSD1306_TAG, "Failed to address the segment to the RAM of the SSD1306 device");
-        return err;
-    }
-    uint8_t ram_data_cmd[] = {
-        OLED_CONTROL_BYTE_DATA,
-        i2c_ssd1306->page[page].segment[segment]};
-    err = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_data_cmd, sizeof(ram_data_cmd), I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
+    esp_err_t err = ssd1306_window_to_ram(i2c_ssd1306, i2c_ssd1306->framebuffer, page, page, segment, segment);
     if (err != ESP_OK)
     {
         ESP_LOGE(SSD1306_TAG, "Failed to transfer the segment to the RAM of the SSD1306 device");
@@ -488,24 +853,7 @@ esp_err_t i2c_ssd1306_segments_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t
         return ESP_ERR_INVALID_ARG;
     }
 
-    uint8_t ram_addr_cmd[] = {
-        OLED_CONTROL_BYTE_CMD,
-        OLED_MASK_PAGE_ADDR | page,
-        OLED_MASK_LSB_NIBBLE_SEG_ADDR | (initial_segment & 0x0F),
-        OLED_MASK_HSB_NIBBLE_SEG_ADDR | (initial_segment >> 4 & 0x0F)};
-    esp_err_t err = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_addr_cmd, sizeof(ram_addr_cmd), I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
-    if (err != ESP_OK)
-    {
-        ESP_LOGE(SSD1306_TAG, "Failed to address the initial segment to the RAM of the SSD1306 device");
-        return err;
-    }
-    uint8_t ram_data_cmd[final_segment - initial_segment + 2];
-    ram_data_cmd[0] = OLED_CONTROL_BYTE_DATA;
-    for (uint8_t i = 0; i < final_segment - initial_segment + 1; i++)
-    {
-        ram_data_cmd[i + 1] = i2c_ssd1306->page[page].segment[initial_segment + i];
-    }
-    err = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_data_cmd, sizeof(ram_data_cmd), I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
+    esp_err_t err = ssd1306_window_to_ram(i2c_ssd1306, i2c_ssd1306->framebuffer, page, page, initial_segment, final_segment);
     if (err != ESP_OK)
     {
         ESP_LOGE(SSD1306_TAG, "Failed to transfer the segments to the RAM of the SSD1306 device");
@@ -523,29 +871,13 @@ esp_err_t i2c_ssd1306_page_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t pag
         return ESP_ERR_INVALID_ARG;
     }
 
-    uint8_t ram_addr_cmd[] = {
-        OLED_CONTROL_BYTE_CMD,
-        OLED_MASK_PAGE_ADDR | page,
-        OLED_MASK_LSB_NIBBLE_SEG_ADDR | (0x00 & 0x0F),
-        OLED_MASK_HSB_NIBBLE_SEG_ADDR | (0x00 >> 4 & 0x0F)};
-    esp_err_t err = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_addr_cmd, sizeof(ram_addr_cmd), I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
-    if (err != ESP_OK)
-    {
-        ESP_LOGE(SSD1306_TAG, "Failed to address the page to the RAM of the SSD1306 device");
-        return err;
-    }
-    uint8_t ram_data_cmd[i2c_ssd1306->width + 1];
-    ram_data_cmd[0] = OLED_CONTROL_BYTE_DATA;
-    for (uint8_t i = 0; i < i2c_ssd1306->width; i++)
-    {
-        ram_data_cmd[i + 1] = i2c_ssd1306->page[page].segment[i];
-    }
-    err = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_data_cmd, sizeof(ram_data_cmd), I2C_SSD1306_TIMEOUT_MS / portTICK_PERIOD_MS);
+    esp_err_t err = ssd1306_window_to_ram(i2c_ssd1306, i2c_ssd1306->framebuffer, page, page, 0, i2c_ssd1306->width - 1);
     if (err != ESP_OK)
     {
         ESP_LOGE(SSD1306_TAG, "Failed to transfer the page to the RAM of the SSD1306 device");
         return err;
     }
+    i2c_ssd1306->dirty.pages &= ~(1 << page);
 
     return err;
 }
@@ -558,26 +890,83 @@ esp_err_t i2c_ssd1306_pages_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t in
         return ESP_ERR_INVALID_ARG;
     }
 
-    esp_err_t err = ESP_OK;
+    esp_err_t err = ssd1306_window_to_ram(i2c_ssd1306, i2c_ssd1306->framebuffer, initial_page, final_page, 0, i2c_ssd1306->width - 1);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to transfer the pages to the RAM of the SSD1306 device");
+        return err;
+    }
     for (uint8_t i = initial_page; i <= final_page; i++)
     {
-        esp_err_t err = i2c_ssd1306_page_to_ram(i2c_ssd1306, i);
-        if (err != ESP_OK)
-            return err;
+        i2c_ssd1306->dirty.pages &= ~(1 << i);
     }
 
     return err;
 }
 
 esp_err_t i2c_ssd1306_buffer_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    int64_t start = esp_timer_get_time();
+    i2c_ssd1306->flush_wire_bytes = 0;
+    esp_err_t err = i2c_ssd1306_pages_to_ram(i2c_ssd1306, 0, i2c_ssd1306->total_pages - 1);
+    ssd1306_stats_frame(i2c_ssd1306, start, err);
+
+    return err;
+}
+
+esp_err_t ssd1306_dirty_window_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *framebuffer, ssd1306_dirty_t *dirty)
 {
     esp_err_t err = ESP_OK;
+    if (i2c_ssd1306->addressing == SSD1306_ADDRESSING_HORIZONTAL)
+    {
+        /* One window covering the bounding rectangle of all dirty pages. */
+        uint8_t initial_page = 0xFF, final_page = 0, initial_segment = 0xFF, final_segment = 0;
+        for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+        {
+            if (!(dirty->pages & (1 << i)))
+                continue;
+            if (initial_page == 0xFF)
+                initial_page = i;
+            final_page = i;
+            if (dirty->start[i] < initial_segment)
+                initial_segment = dirty->start[i];
+            if (dirty->end[i] > final_segment)
+                final_segment = dirty->end[i];
+        }
+        if (initial_page == 0xFF)
+            return ESP_OK;
+        err = ssd1306_window_to_ram(i2c_ssd1306, framebuffer, initial_page, final_page, initial_segment, final_segment);
+        if (err != ESP_OK)
+            return err;
+        dirty->pages = 0;
+
+        return err;
+    }
+
     for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
     {
-        err = i2c_ssd1306_page_to_ram(i2c_ssd1306, i);
+        if (!(dirty->pages & (1 << i)))
+            continue;
+        err = ssd1306_window_to_ram(i2c_ssd1306, framebuffer, i, i, dirty->start[i], dirty->end[i]);
         if (err != ESP_OK)
             return err;
+        dirty->pages &= ~(1 << i);
+    }
+
+    return err;
+}
+
+esp_err_t i2c_ssd1306_dirty_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    int64_t start = esp_timer_get_time();
+    i2c_ssd1306->flush_wire_bytes = 0;
+    esp_err_t err = ssd1306_dirty_window_to_ram(i2c_ssd1306, i2c_ssd1306->framebuffer, &i2c_ssd1306->dirty);
+    ssd1306_stats_frame(i2c_ssd1306, start, err);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to transfer the dirty windows to the RAM of the SSD1306 device");
+        return err;
     }
 
     return err;
-}
\ No newline at end of file
+}
@@ -5,6 +5,9 @@
 #include <esp_log.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ssd1306_font.h"
+#include "ssd1306_image.h"
 
 #define SSD1306_TAG "SSD1306"
 
@@ -22,19 +25,74 @@ typedef enum
 } ssd1306_wise_t;
 
 /**
- * @brief Structure for an SSD1306 page segment.
+ * @brief Enumeration for SSD1306 memory addressing used by the flush functions.
  *
- * Contains a pointer to the segment data for a page in the SSD1306 buffer.
+ * Page addressing sends every page as an address command plus a data transaction. Horizontal addressing
+ * programs a column/page window once and streams the whole window, so a full frame is a single data transaction.
  */
-typedef struct
+typedef enum
 {
-    uint8_t *segment;
-} ssd1306_page_t;
+    SSD1306_ADDRESSING_PAGE,
+    SSD1306_ADDRESSING_HORIZONTAL
+} ssd1306_addressing_t;
+
+#define SSD1306_MAX_WIDTH 128
+#define SSD1306_MAX_PAGES 8
+
+/**
+ * @brief Bytes reserved in front of the framebuffer pixels.
+ *
+ * The last header byte holds OLED_CONTROL_BYTE_DATA so that runs of the framebuffer can be transmitted
+ * in place, while the pixels stay 4-byte aligned.
+ */
+#define SSD1306_FRAMEBUFFER_HEADER 4
+
+/**
+ * @brief Size in bytes of a framebuffer for the given display geometry, header included.
+ *
+ * The pixels are page-major: page 0 segments 0..width-1, then page 1, and so on.
+ */
+#define SSD1306_FRAMEBUFFER_SIZE(width, height) (SSD1306_FRAMEBUFFER_HEADER + (width) * ((height) / 8))
+
+/**
+ * @brief Optional compile-time panel geometry.
+ *
+ * Selected in menuconfig (SSD1306 > Panel geometry) or with -D SSD1306_FIXED_WIDTH=... -D SSD1306_FIXED_HEIGHT=...
+ * Handles of this geometry draw through specialized paths with the geometry folded into constants; handles of
+ * any other geometry keep using the runtime-generic paths.
+ */
+#if !defined(SSD1306_FIXED_WIDTH) && defined(CONFIG_SSD1306_GEOMETRY_128X32)
+#define SSD1306_FIXED_WIDTH 128
+#define SSD1306_FIXED_HEIGHT 32
+#elif !defined(SSD1306_FIXED_WIDTH) && defined(CONFIG_SSD1306_GEOMETRY_128X64)
+#define SSD1306_FIXED_WIDTH 128
+#define SSD1306_FIXED_HEIGHT 64
+#endif
+
+/**
+ * @brief Size in bytes of the framebuffer storage embedded in every handle.
+ *
+ * Sized for the compile-time geometry when one is selected and for the largest panel otherwise. With
+ * menuconfig's SSD1306 > Displays supply their own framebuffer, or -D SSD1306_EMBEDDED_FRAMEBUFFER_SIZE=0, handles
+ * embed no storage and every configuration must pass 'framebuffer'.
+ */
+#ifndef SSD1306_EMBEDDED_FRAMEBUFFER_SIZE
+#if defined(CONFIG_SSD1306_CALLER_FRAMEBUFFER)
+#define SSD1306_EMBEDDED_FRAMEBUFFER_SIZE 0
+#elif defined(SSD1306_FIXED_WIDTH)
+#define SSD1306_EMBEDDED_FRAMEBUFFER_SIZE SSD1306_FRAMEBUFFER_SIZE(SSD1306_FIXED_WIDTH, SSD1306_FIXED_HEIGHT)
+#else
+#define SSD1306_EMBEDDED_FRAMEBUFFER_SIZE SSD1306_FRAMEBUFFER_SIZE(SSD1306_MAX_WIDTH, SSD1306_MAX_PAGES * 8)
+#endif
+#endif
 
 /**
  * @brief Configuration for the I2C SSD1306 display.
  *
  * Holds configuration parameters for both the SSD1306 display and the I2C master.
+ * 'framebuffer' is optional caller-supplied storage of SSD1306_FRAMEBUFFER_SIZE(width, height) bytes,
+ * aligned to 4 bytes; when NULL the storage embedded in the handle is used, which must then be at least that large
+ * (see SSD1306_EMBEDDED_FRAMEBUFFER_SIZE).
  */
 typedef struct
 {
@@ -43,28 +101,493 @@ typedef struct
     uint8_t width;
     uint8_t height;
     ssd1306_wise_t wise;
+    ssd1306_addressing_t addressing;
+    uint8_t *framebuffer;
 } i2c_ssd1306_config_t;
 
+/**
+ * @brief Dirty region of a framebuffer.
+ *
+ * One bit per page in 'pages' and, for every dirty page, the inclusive segment range 'start'..'end'.
+ */
+typedef struct
+{
+    uint8_t pages;
+    uint8_t start[SSD1306_MAX_PAGES];
+    uint8_t end[SSD1306_MAX_PAGES];
+} ssd1306_dirty_t;
+
+/**
+ * @brief Raster operation used to combine drawn data with the SSD1306 buffer.
+ *
+ * SSD1306_ROP_OR sets the drawn bits and keeps everything else. SSD1306_ROP_COPY overwrites the whole area
+ * covered by the drawing. SSD1306_ROP_AND_NOT clears the drawn bits and SSD1306_ROP_XOR toggles them, so drawing
+ * the same data twice with SSD1306_ROP_XOR restores the buffer. Text supports SSD1306_ROP_OR and SSD1306_ROP_COPY.
+ */
+typedef enum
+{
+    SSD1306_ROP_OR,
+    SSD1306_ROP_COPY,
+    SSD1306_ROP_AND_NOT,
+    SSD1306_ROP_XOR
+} ssd1306_rop_t;
+
+/**
+ * @brief Direction of the SSD1306 hardware scroll.
+ */
+typedef enum
+{
+    SSD1306_SCROLL_RIGHT,
+    SSD1306_SCROLL_LEFT
+} ssd1306_scroll_direction_t;
+
+/**
+ * @brief Interval between two continuous scroll steps, in frames.
+ *
+ * The values are the register encoding expected by the SSD1306.
+ */
+typedef enum
+{
+    SSD1306_SCROLL_5_FRAMES = 0x00,
+    SSD1306_SCROLL_64_FRAMES = 0x01,
+    SSD1306_SCROLL_128_FRAMES = 0x02,
+    SSD1306_SCROLL_256_FRAMES = 0x03,
+    SSD1306_SCROLL_3_FRAMES = 0x04,
+    SSD1306_SCROLL_4_FRAMES = 0x05,
+    SSD1306_SCROLL_25_FRAMES = 0x06,
+    SSD1306_SCROLL_2_FRAMES = 0x07
+} ssd1306_scroll_speed_t;
+
+/**
+ * @brief Point of a polygon, in pixels. Coordinates may lie outside of the panel.
+ */
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+} ssd1306_point_t;
+
+#define SSD1306_POLYGON_MAX_POINTS 16
+
+/**
+ * @brief 1bpp sprite for i2c_ssd1306_buffer_sprite().
+ *
+ * 'bitmap' holds (height + 7) / 8 page rows of 'width' column bytes, LSB at the top, like the framebuffer.
+ * 'mask' has the same layout and selects the pixels the sprite covers; when NULL, the sprite covers its whole
+ * width x height box.
+ */
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *bitmap;
+    const uint8_t *mask;
+} ssd1306_sprite_t;
+
+#define SSD1306_STATS_LATENCY_BUCKETS 44
+#define SSD1306_STATS_ERROR_CODES 4
+
+/**
+ * @brief Number of failed I2C transactions that returned 'code'.
+ */
+typedef struct
+{
+    esp_err_t code;
+    uint32_t count;
+} ssd1306_stats_error_t;
+
+/**
+ * @brief Flush telemetry of an SSD1306 handle.
+ *
+ * A frame is one flush that put something on the bus: a full or dirty flush, a frame of the asynchronous flush
+ * task or a scheduler turn. Its latency, from the start of the flush until it returns, is counted in
+ * 'latency_histogram', whose buckets are half an octave wide: values below 2 us count in the bucket of the same
+ * index, otherwise bucket 2 * n holds 2^n .. 1.5 * 2^n - 1 us and bucket 2 * n + 1 the rest of the octave.
+ * The last bucket also counts everything above it.
+ *
+ * 'worst_stall_us' is the longest single I2C transaction, failed ones included. Failed transactions are counted
+ * per error code in 'errors' for the first SSD1306_STATS_ERROR_CODES distinct codes and in 'other_errors' after.
+ */
+typedef struct
+{
+    uint32_t frames;
+    uint32_t failed_frames;
+    uint32_t transactions;
+    uint64_t bytes;
+    uint32_t worst_latency_us;
+    uint32_t worst_stall_us;
+    uint32_t latency_histogram[SSD1306_STATS_LATENCY_BUCKETS];
+    ssd1306_stats_error_t errors[SSD1306_STATS_ERROR_CODES];
+    uint32_t other_errors;
+} ssd1306_stats_t;
+
+typedef struct ssd1306_async ssd1306_async_t;
+typedef struct ssd1306_scheduler ssd1306_scheduler_t;
+typedef struct ssd1306_gray ssd1306_gray_t;
+typedef struct ssd1306_console ssd1306_console_t;
+
 /**
  * @brief Handle for the I2C SSD1306 display.
  *
- * Contains runtime information including the I2C device handle, display dimensions, and pointers to the page buffers.
+ * Contains runtime information including the I2C device handle and its address and SCL rate, display dimensions
+ * and the framebuffer.
+ * 'framebuffer' points to the pixels behind the header of either caller-supplied storage or
+ * 'framebuffer_storage', so the handle must not be copied after initialization. 'framebuffer_storage' only exists
+ * when SSD1306_EMBEDDED_FRAMEBUFFER_SIZE is non-zero.
+ *
+ * Every buffer writer records the touched area in 'dirty'. 'flush_wire_bytes' holds the number of bytes put
+ * on the I2C bus (address byte plus payload of every transaction) by the last full or dirty flush.
+ * 'async' is set while the asynchronous flush task runs, 'scheduler' while the display is added to a shared-bus
+ * flush scheduler, 'gray' while the grayscale mode runs and 'console' while the text console runs; each of them
+ * owns the display's flushes.
+ *
+ * 'scroll_pages' has one bit per page moved by the running continuous scroll; the display RAM must not be
+ * written while it is non-zero. 'scroll_fixed_rows' and 'scroll_rows' describe the vertical scroll area.
+ *
+ * 'stats' holds the flush telemetry, see i2c_ssd1306_stats_get().
  */
 typedef struct
 {
     i2c_master_dev_handle_t i2c_master_dev;
+    uint16_t i2c_device_address;
+    uint32_t i2c_scl_speed_hz;
     uint8_t width;
     uint8_t height;
     uint8_t total_pages;
-    ssd1306_page_t *page;
+    ssd1306_addressing_t addressing;
+    uint8_t *framebuffer;
+#if SSD1306_EMBEDDED_FRAMEBUFFER_SIZE > 0
+    uint32_t framebuffer_storage[(SSD1306_EMBEDDED_FRAMEBUFFER_SIZE + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
+#endif
+    ssd1306_dirty_t dirty;
+    uint32_t flush_wire_bytes;
+    ssd1306_async_t *async;
+    ssd1306_scheduler_t *scheduler;
+    ssd1306_gray_t *gray;
+    ssd1306_console_t *console;
+    uint8_t scroll_pages;
+    uint8_t scroll_fixed_rows;
+    uint8_t scroll_rows;
+    ssd1306_stats_t stats;
 } i2c_ssd1306_handle_t;
 
+/**
+ * @brief Behaviour of i2c_ssd1306_present() while the previous frame is still being flushed.
+ *
+ * SSD1306_PRESENT_WAIT blocks until the flush task is idle. SSD1306_PRESENT_DROP_STALE returns at once and
+ * skips the frame; its changes stay dirty and go out with the next successful present.
+ */
+typedef enum
+{
+    SSD1306_PRESENT_WAIT,
+    SSD1306_PRESENT_DROP_STALE
+} ssd1306_present_policy_t;
+
+/**
+ * @brief Callback invoked from the flush task after every frame.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param err         Result of the flush.
+ * @param user_ctx    User context given in the asynchronous configuration.
+ */
+typedef void (*ssd1306_frame_done_cb_t)(i2c_ssd1306_handle_t *i2c_ssd1306, esp_err_t err, void *user_ctx);
+
+/**
+ * @brief Configuration for the asynchronous SSD1306 flush task.
+ */
+typedef struct
+{
+    UBaseType_t task_priority;
+    uint32_t task_stack_size;
+    BaseType_t task_core_id;
+    ssd1306_present_policy_t policy;
+    ssd1306_frame_done_cb_t on_frame_done;
+    void *user_ctx;
+} i2c_ssd1306_async_config_t;
+
+#define I2C_SSD1306_ASYNC_CONFIG_DEFAULT() { \
+    .task_priority = 5,                      \
+    .task_stack_size = 2048,                 \
+    .task_core_id = tskNO_AFFINITY,          \
+    .policy = SSD1306_PRESENT_DROP_STALE,    \
+    .on_frame_done = NULL,                   \
+    .user_ctx = NULL}
+
+/**
+ * @brief Configuration for the shared-bus SSD1306 flush scheduler.
+ *
+ * 'budget_bytes' is the number of bytes one display may put on the bus per round-robin turn. A turn ends with
+ * the first page window that reaches the budget, so every turn sends at least one page window.
+ * 'on_frame_done' runs in the scheduler task when a display has sent everything presented to it or a transfer
+ * failed; it must not present the display it is called for.
+ */
+typedef struct
+{
+    UBaseType_t task_priority;
+    uint32_t task_stack_size;
+    BaseType_t task_core_id;
+    uint16_t budget_bytes;
+    ssd1306_frame_done_cb_t on_frame_done;
+    void *user_ctx;
+} i2c_ssd1306_scheduler_config_t;
+
+#define I2C_SSD1306_SCHEDULER_CONFIG_DEFAULT() { \
+    .task_priority = 5,                          \
+    .task_stack_size = 2048,                     \
+    .task_core_id = tskNO_AFFINITY,              \
+    .budget_bytes = 256,                         \
+    .on_frame_done = NULL,                       \
+    .user_ctx = NULL}
+
+#define SSD1306_SCHEDULER_MAX_DISPLAYS 4
+
+/**
+ * @brief Configuration for the SCL rate calibration of i2c_ssd1306_scl_calibrate().
+ *
+ * The rate is raised from 'start_hz' by 'step_hz' up to 'max_hz'; every step pushes 'frames_per_step' full frames
+ * and passes only if none of their transactions fails. The display settles 'margin_steps' steps below the
+ * fastest passing rate, never below 'start_hz'. With 'use_stored', a rate persisted by an earlier calibration is
+ * applied instead, after one verification frame.
+ */
+typedef struct
+{
+    uint32_t start_hz;
+    uint32_t max_hz;
+    uint32_t step_hz;
+    uint16_t frames_per_step;
+    uint8_t margin_steps;
+    bool use_stored;
+} i2c_ssd1306_scl_calibration_config_t;
+
+#define I2C_SSD1306_SCL_CALIBRATION_CONFIG_DEFAULT() { \
+    .start_hz = 400000,                                \
+    .max_hz = 1000000,                                 \
+    .step_hz = 100000,                                 \
+    .frames_per_step = 20,                             \
+    .margin_steps = 1,                                 \
+    .use_stored = true}
+
+/**
+ * @brief Number of gray levels of the grayscale mode, from 0 (off) to SSD1306_GRAY_LEVELS - 1 (fully lit).
+ */
+#define SSD1306_GRAY_LEVELS 4
+
+/**
+ * @brief Number of full frames of a gray cycle.
+ */
+#define SSD1306_GRAY_SUBFRAMES 3
+
+/**
+ * @brief Configuration for the grayscale mode of i2c_ssd1306_gray_start().
+ *
+ * A gray cycle is SSD1306_GRAY_SUBFRAMES full frames; 'subframe_hz' is the rate of the timer that starts them.
+ * It must not exceed i2c_ssd1306_gray_max_subframe_hz(), the rate at which whole frames fit the SCL rate: a
+ * full 128x32 frame takes about 12 ms at 400 kHz (about 82 subframes/s), a 128x64 one twice as long. Ticks
+ * that find the previous subframe still on the bus are dropped, which gives the subframes uneven display time
+ * and skews the levels. With 'subframe_hz' at 0 there is no timer and no task, and the application sends every
+ * subframe with i2c_ssd1306_gray_step(). The flush task should outrank everything else that runs for long on its core,
+ * since every late subframe shows as flicker.
+ */
+typedef struct
+{
+    uint32_t subframe_hz;
+    UBaseType_t task_priority;
+    uint32_t task_stack_size;
+    BaseType_t task_core_id;
+} i2c_ssd1306_gray_config_t;
+
+#define I2C_SSD1306_GRAY_CONFIG_DEFAULT() { \
+    .subframe_hz = 40,                      \
+    .task_priority = 20,                    \
+    .task_stack_size = 2048,                \
+    .task_core_id = tskNO_AFFINITY}
+
+/**
+ * @brief Refresh measurement of the grayscale mode.
+ *
+ * 'subframes' counts the subframes sent since the start or the last i2c_ssd1306_gray_reset_stats(), and
+ * 'failed_subframes' those with a failed transaction. 'missed_ticks' counts timer ticks that found the previous
+ * subframe still on the bus and were dropped. 'subframe_period_us' is the average and 'worst_subframe_period_us'
+ * the longest time between the starts of two subframes; 'refresh_hz' is the achieved rate of whole gray cycles.
+ */
+typedef struct
+{
+    uint32_t subframes;
+    uint32_t failed_subframes;
+    uint32_t missed_ticks;
+    uint32_t subframe_period_us;
+    uint32_t worst_subframe_period_us;
+    uint32_t refresh_hz;
+} ssd1306_gray_stats_t;
+
+#define SSD1306_CONSOLE_LINE_MAX 48
+#define SSD1306_CONSOLE_PRINTF_MAX 128
+
+/**
+ * @brief Configuration for the text console of i2c_ssd1306_console_start().
+ *
+ * 'font' must be 8 pixels high (i2c_ssd1306_buffer_text()'s 8x8 font when NULL), so that a text line is one page.
+ * 'policy' decides what a write does when it would scroll away a line the flush task has not sent yet:
+ * SSD1306_PRESENT_WAIT blocks until the task caught up, SSD1306_PRESENT_DROP_STALE scrolls on and counts the line
+ * as dropped. With 'task_stack_size' at 0 there is no task and every write sends its lines from the calling task.
+ */
+typedef struct
+{
+    const ssd1306_font_t *font;
+    ssd1306_present_policy_t policy;
+    UBaseType_t task_priority;
+    uint32_t task_stack_size;
+    BaseType_t task_core_id;
+} i2c_ssd1306_console_config_t;
+
+#define I2C_SSD1306_CONSOLE_CONFIG_DEFAULT() { \
+    .font = NULL,                              \
+    .policy = SSD1306_PRESENT_WAIT,            \
+    .task_priority = 5,                        \
+    .task_stack_size = 3072,                   \
+    .task_core_id = tskNO_AFFINITY}
+
+/**
+ * @brief Counters of the text console.
+ *
+ * 'lines' counts the lines started, 'dropped_lines' those scrolled away before their last change reached the
+ * display, 'page_writes' the line pages sent and 'failed_writes' the sends that failed and were retried later.
+ */
+typedef struct
+{
+    uint32_t lines;
+    uint32_t dropped_lines;
+    uint32_t page_writes;
+    uint32_t failed_writes;
+} ssd1306_console_stats_t;
+
+/**
+ * @brief Horizontal alignment of the content of a widget inside its box.
+ */
+typedef enum
+{
+    SSD1306_ALIGN_LEFT,
+    SSD1306_ALIGN_CENTER,
+    SSD1306_ALIGN_RIGHT
+} ssd1306_align_t;
+
+/**
+ * @brief Kind of a retained widget.
+ */
+typedef enum
+{
+    SSD1306_WIDGET_LABEL,
+    SSD1306_WIDGET_VALUE,
+    SSD1306_WIDGET_ICON,
+    SSD1306_WIDGET_BAR
+} ssd1306_widget_type_t;
+
+/**
+ * @brief Box and style of a retained widget.
+ *
+ * The box 'x', 'y', 'width' x 'height' must lie inside the panel; a widget only ever draws inside it. Text is drawn
+ * with 'font' (i2c_ssd1306_buffer_text()'s 8x8 font when NULL), aligned by 'align' and centered vertically; icons
+ * are aligned the same way. 'invert' draws light content on a lit box.
+ */
+typedef struct
+{
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;
+    uint8_t height;
+    const ssd1306_font_t *font;
+    ssd1306_align_t align;
+    bool invert;
+} i2c_ssd1306_widget_config_t;
+
+#define SSD1306_WIDGET_TEXT_MAX 24
+
+/**
+ * @brief Retained widget bound to an SSD1306 handle.
+ *
+ * The widget is owned by the caller and keeps what it shows, so a setter redraws only the widget's box and only
+ * when the content changes. Labels keep a copy of their text, truncated to SSD1306_WIDGET_TEXT_MAX - 1 bytes;
+ * 'prefix' and 'suffix' of values and the sprite of icons are referenced and must outlive the widget.
+ */
+typedef struct
+{
+    ssd1306_widget_type_t type;
+    i2c_ssd1306_handle_t *i2c_ssd1306;
+    i2c_ssd1306_widget_config_t config;
+    char text[SSD1306_WIDGET_TEXT_MAX];
+    const char *prefix;
+    const char *suffix;
+    int32_t value;
+    int32_t min;
+    int32_t max;
+    const ssd1306_sprite_t *sprite;
+} i2c_ssd1306_widget_t;
+
+/**
+ * @brief Draw operation of a display list command.
+ */
+typedef enum
+{
+    SSD1306_LIST_CLEAR,
+    SSD1306_LIST_PIXEL,
+    SSD1306_LIST_FILL_RECT,
+    SSD1306_LIST_RECT,
+    SSD1306_LIST_LINE,
+    SSD1306_LIST_CIRCLE,
+    SSD1306_LIST_FILL_CIRCLE,
+    SSD1306_LIST_TEXT,
+    SSD1306_LIST_SPRITE
+} ssd1306_list_op_t;
+
+/**
+ * @brief Recorded draw command.
+ *
+ * 'x1', 'y1', 'x2' and 'y2' hold the operation's coordinates: two points for lines, origin and size for rectangles,
+ * center and radius in 'x2' for circles, the origin for text and sprites.
+ */
+typedef struct
+{
+    uint8_t op;
+    bool fill;
+    uint8_t rop;
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+    union
+    {
+        struct
+        {
+            const char *text;
+            const ssd1306_font_t *font;
+        } text;
+        const ssd1306_sprite_t *sprite;
+    } data;
+} ssd1306_list_command_t;
+
+/**
+ * @brief Display list: draw commands recorded into caller-supplied storage and replayed by i2c_ssd1306_list_submit().
+ *
+ * Recording only appends a command; the whole list is validated once, on its first submit after a change, and
+ * clipped to the display it is submitted to. Texts, fonts and sprites are referenced and must outlive the list.
+ */
+typedef struct
+{
+    ssd1306_list_command_t *commands;
+    uint16_t capacity;
+    uint16_t count;
+    bool overflow;
+    bool validated;
+} ssd1306_list_t;
 
 void init_ssd1306(void);
+esp_err_t init_ssd1306_async(void);
 i2c_master_bus_handle_t get_i2c_bus_handle(void);
+i2c_ssd1306_handle_t *get_ssd1306_handle(void);
 esp_err_t ssd1306_print_str(uint8_t x, uint8_t y, const char *text, bool invert);
 esp_err_t ssd1306_display(void);
 esp_err_t ssd1306_buffer_clear(void);
+esp_err_t ssd1306_fill_space(uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill);
 
 
 /**
@@ -78,8 +601,8 @@ esp_err_t ssd1306_buffer_clear(void);
  *
  * @return
  *   - ESP_OK on success.
- *   - ESP_ERR_INVALID_ARG if an argument is invalid.
- *   - ESP_ERR_NO_MEM if memory allocation fails.
+ *   - ESP_ERR_INVALID_ARG if an argument is invalid, the supplied framebuffer is misaligned or no framebuffer is
+ *     supplied and the embedded storage is too small for the geometry.
  *   - ESP_FAIL on other failures.
  */
 esp_err_t i2c_ssd1306_init(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_config_t i2c_ssd1306_config, i2c_ssd1306_handle_t *i2c_ssd1306);
@@ -87,7 +610,8 @@ esp_err_t i2c_ssd1306_init(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_c
 /**
  * @brief Deinitialize the I2C SSD1306 display.
  *
- * Frees the memory allocated for the SSD1306 display handle.
+ * Stops the asynchronous flush task or removes the display from its scheduler, then removes the SSD1306 device
+ * from the I2C bus. The framebuffer is not owned by the heap, so nothing is freed.
  *
  * @param i2c_ssd1306 Pointer to the SSD1306 handle.
  *
@@ -159,10 +683,104 @@ esp_err_t i2c_ssd1306_buffer_fill_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8
  */
 esp_err_t i2c_ssd1306_buffer_fill_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill);
 
+/*
+ * Shape primitives. Coordinates are signed and shapes are clipped to the panel instead of being rejected, so they
+ * may extend past its edges. 'fill' sets the pixels of the shape when true and clears them when false.
+ */
+
+/**
+ * @brief Draw a horizontal line of 'length' pixels starting at (x, y) and going right.
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_hline(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint16_t length, bool fill);
+
+/**
+ * @brief Draw a vertical line of 'length' pixels starting at (x, y) and going down.
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_vline(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint16_t length, bool fill);
+
+/**
+ * @brief Draw a line from (x1, y1) to (x2, y2), both ends included.
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_line(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool fill);
+
+/**
+ * @brief Draw the outline of a circle of radius 'r' centred on (cx, cy).
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_circle(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t cx, int16_t cy, uint8_t r, bool fill);
+
+/**
+ * @brief Draw a filled circle of radius 'r' centred on (cx, cy).
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_fill_circle(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t cx, int16_t cy, uint8_t r, bool fill);
+
+/**
+ * @brief Draw the part of a circle outline between two angles.
+ *
+ * Angles are in degrees, 0 points right and angles grow clockwise on screen (90 points down). The arc runs
+ * clockwise from 'start_angle' to 'end_angle'; a difference of 360 or more draws the whole circle.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param cx          X-coordinate of the centre.
+ * @param cy          Y-coordinate of the centre.
+ * @param r           Radius in pixels.
+ * @param start_angle Angle the arc starts at.
+ * @param end_angle   Angle the arc ends at.
+ * @param fill        If true, pixels are set; if false, pixels are cleared.
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_arc(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t cx, int16_t cy, uint8_t r, int16_t start_angle, int16_t end_angle, bool fill);
+
+/**
+ * @brief Draw the outline of a w x h rectangle with its top-left corner at (x, y) and corners of radius 'r'.
+ *
+ * The radius is reduced to fit the rectangle; 0 gives square corners.
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_round_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t r, bool fill);
+
+/**
+ * @brief Draw a filled w x h rectangle with its top-left corner at (x, y) and corners of radius 'r'.
+ *
+ * @return ESP_OK.
+ */
+esp_err_t i2c_ssd1306_buffer_fill_round_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t r, bool fill);
+
+/**
+ * @brief Draw the closed outline through 'count' points.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if 'points' is NULL or 'count' is not between 2 and SSD1306_POLYGON_MAX_POINTS.
+ */
+esp_err_t i2c_ssd1306_buffer_polygon(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_point_t *points, uint8_t count, bool fill);
+
+/**
+ * @brief Draw a filled polygon through 'count' points, outline included. Self-intersecting polygons are filled
+ *        with the even-odd rule.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if 'points' is NULL or 'count' is not between 2 and SSD1306_POLYGON_MAX_POINTS.
+ */
+esp_err_t i2c_ssd1306_buffer_fill_polygon(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_point_t *points, uint8_t count, bool fill);
+
 /**
  * @brief Render text into the SSD1306 buffer.
  *
- * Copies 8x8 font characters representing the provided string into the SSD1306 buffer.
+ * Copies 8x8 font characters (ssd1306_font_8x8) representing the provided string into the SSD1306 buffer,
+ * one character cell per byte of the string.
  *
  * @param i2c_ssd1306 Pointer to the SSD1306 handle.
  * @param x           X-coordinate for the text's starting position.
@@ -174,6 +792,42 @@ esp_err_t i2c_ssd1306_buffer_fill_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8
  */
 esp_err_t i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, bool invert);
 
+/**
+ * @brief Render text into the SSD1306 buffer with the given raster operation.
+ *
+ * Same as i2c_ssd1306_buffer_text(), but with SSD1306_ROP_COPY the 8-row band under the text is overwritten
+ * instead of ORed, so previous content does not need to be cleared first.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param x           X-coordinate for the text's starting position.
+ * @param y           Y-coordinate for the text's starting position.
+ * @param text        Null-terminated string to render.
+ * @param invert      If true, the text is rendered inverted.
+ * @param rop         Raster operation used to combine the glyphs with the buffer.
+ *
+ * @return ESP_OK on success, or an error code otherwise.
+ */
+esp_err_t i2c_ssd1306_buffer_text_rop(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, bool invert, ssd1306_rop_t rop);
+
+/**
+ * @brief Render UTF-8 text with a compact font into the SSD1306 buffer.
+ *
+ * Glyphs are placed at their proportional advances and drawn as page strips, 'font->height' rows tall.
+ * Code points the font does not cover are drawn with its fallback glyph. With 'invert' or SSD1306_ROP_COPY the
+ * blank columns between glyphs are written too, so the whole text box is covered.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param x           X-coordinate for the text's starting position.
+ * @param y           Y-coordinate for the top row of the text.
+ * @param text        Null-terminated UTF-8 string to render.
+ * @param font        Font to render with, e.g. ssd1306_font_16.
+ * @param invert      If true, the text is rendered inverted.
+ * @param rop         Raster operation used to combine the glyphs with the buffer.
+ *
+ * @return ESP_OK on success, or an error code otherwise.
+ */
+esp_err_t i2c_ssd1306_buffer_text_font(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop);
+
 /**
  * @brief Render an integer into the SSD1306 buffer.
  *
@@ -223,9 +877,51 @@ esp_err_t i2c_ssd1306_buffer_float(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x,
 esp_err_t i2c_ssd1306_buffer_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height, bool invert);
 
 /**
- * @brief Transfer a specific buffer segment to the SSD1306 display RAM.
+ * @brief Decode an image asset into the SSD1306 buffer.
  *
- * Moves the designated segment from the buffer to the corresponding location in the display's RAM.
+ * The asset is decoded as a stream: every decoded byte is written straight into the framebuffer page it lands on,
+ * without an intermediate buffer, and decoding stops once the rest of the image lies below the panel. The image
+ * replaces the pixels of its width x height box and is clipped to the panel, so (x, y) may be negative or place
+ * it partly outside.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param x           X-coordinate of the image's left column.
+ * @param y           Y-coordinate of the image's top row.
+ * @param image       Image asset, see ssd1306_image.h.
+ * @param invert      If true, the image is rendered inverted.
+ *
+ * @return
+ *   - ESP_OK on success, also when the image lies outside of the panel.
+ *   - ESP_ERR_INVALID_ARG if the asset has no data, a zero size or an unknown encoding.
+ *   - ESP_ERR_INVALID_SIZE if the data ends before the visible part of the image is decoded; the pixels decoded
+ *     up to there are kept.
+ */
+esp_err_t i2c_ssd1306_buffer_image_asset(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, const ssd1306_image_t *image, bool invert);
+
+/**
+ * @brief Blit a sprite into the SSD1306 buffer.
+ *
+ * The sprite is clipped to the panel, so (x, y) may be negative or place it partly outside. Within the pixels the
+ * sprite covers, SSD1306_ROP_OR sets its set bits, SSD1306_ROP_AND_NOT clears them, SSD1306_ROP_XOR toggles them
+ * and SSD1306_ROP_COPY replaces the buffer with the sprite; pixels outside of its mask are never touched.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param x           X-coordinate of the sprite's left column.
+ * @param y           Y-coordinate of the sprite's top row.
+ * @param sprite      Sprite to draw.
+ * @param rop         Raster operation used to combine the sprite with the buffer.
+ *
+ * @return
+ *   - ESP_OK on success, including a sprite entirely outside of the panel.
+ *   - ESP_ERR_INVALID_ARG if the sprite has no bitmap or an empty size.
+ */
+esp_err_t i2c_ssd1306_buffer_sprite(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop);
+
+/**
+ * @brief Transfer a specific buffer segment to the SSD1306 display RAM.
+ *
+ * Moves the designated segment from the buffer to the corresponding location in the display's RAM.
+ * The dirty state is left untouched.
  *
  * @param i2c_ssd1306 Pointer to the SSD1306 handle.
  * @param page        Page number that contains the segment.
@@ -239,6 +935,7 @@ esp_err_t i2c_ssd1306_segment_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t
  * @brief Transfer a range of buffer segments to the SSD1306 display RAM.
  *
  * Moves a sequence of segments from the specified page in the buffer to the display's RAM.
+ * The dirty state is left untouched.
  *
  * @param i2c_ssd1306     Pointer to the SSD1306 handle.
  * @param page            Page number that contains the segments.
@@ -252,7 +949,7 @@ esp_err_t i2c_ssd1306_segments_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t
 /**
  * @brief Transfer an entire page from the buffer to the SSD1306 display RAM.
  *
- * Updates the display's RAM by transferring all segments of the specified page.
+ * Updates the display's RAM by transferring all segments of the specified page and clears its dirty state.
  *
  * @param i2c_ssd1306 Pointer to the SSD1306 handle.
  * @param page        Page number to update.
@@ -277,10 +974,692 @@ esp_err_t i2c_ssd1306_pages_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t in
 /**
  * @brief Transfer the entire buffer to the SSD1306 display RAM.
  *
- * Updates the display's RAM by transferring the contents of all pages in the buffer.
+ * Updates the display's RAM by transferring the contents of all pages in the buffer and clears the dirty state.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, or an error code otherwise.
+ */
+esp_err_t i2c_ssd1306_buffer_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Transfer only the changed parts of the buffer to the SSD1306 display RAM.
+ *
+ * With page addressing, sends the dirty segment range of every dirty page through
+ * i2c_ssd1306_segments_to_ram(). With horizontal addressing, sends the bounding rectangle of the dirty pages
+ * as one window. The dirty state is cleared afterwards. The number of bytes put on the bus is left in 'flush_wire_bytes' of the handle.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE while a continuous scroll runs, or an error code otherwise.
+ *         On failure the unsent pages stay dirty.
+ */
+esp_err_t i2c_ssd1306_dirty_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Start the asynchronous flush task of the SSD1306 display.
+ *
+ * Allocates a front buffer and creates the flush task, pinned to 'task_core_id'. The handle's framebuffer
+ * becomes the back buffer: draw into it as usual and hand frames over with i2c_ssd1306_present().
+ * The synchronous *_to_ram functions stay usable but must not run while a frame is in flight.
+ *
+ * @param i2c_ssd1306  Pointer to the SSD1306 handle.
+ * @param async_config Configuration of the flush task.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_STATE if the flush task already runs, or the display is scheduled, in grayscale mode or a
+ *     console.
+ *   - ESP_ERR_NO_MEM if the front buffer or the task could not be allocated.
+ */
+esp_err_t i2c_ssd1306_async_start(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_async_config_t *async_config);
+
+/**
+ * @brief Stop the asynchronous flush task of the SSD1306 display.
+ *
+ * Waits for the frame in flight, deletes the flush task and frees the front buffer.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the flush task does not run.
+ */
+esp_err_t i2c_ssd1306_async_stop(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Hand the back buffer over to the flush task without waiting for the transfer.
+ *
+ * Copies the dirty windows of the back buffer into the front buffer, clears the dirty state and wakes the
+ * flush task. Presenting a clean buffer does nothing, so it is cheap to call on every loop iteration.
+ * For a display added to a scheduler, the frame is queued behind the turn in flight and never dropped.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return
+ *   - ESP_OK if the frame was handed over or nothing was dirty.
+ *   - ESP_ERR_TIMEOUT if the frame was dropped by the SSD1306_PRESENT_DROP_STALE policy.
+ *   - ESP_ERR_INVALID_STATE if neither the flush task runs nor the display is scheduled.
+ */
+esp_err_t i2c_ssd1306_present(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Wait until the flush task has finished the frame in flight.
  *
  * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param timeout     Maximum time to wait, in ticks.
+ *
+ * @return
+ *   - The result of the last completed flush (ESP_OK if none ran yet).
+ *   - ESP_ERR_TIMEOUT if the frame is still in flight after 'timeout'.
+ *   - ESP_ERR_INVALID_STATE if the flush task does not run.
+ */
+esp_err_t i2c_ssd1306_async_wait(i2c_ssd1306_handle_t *i2c_ssd1306, TickType_t timeout);
+
+/**
+ * @brief Start a continuous horizontal scroll of the SSD1306 display.
+ *
+ * The controller moves pages 'initial_page'..'final_page' by one column every 'speed' frames on its own, so the
+ * scroll costs no bus traffic per step. The display RAM must not be written until i2c_ssd1306_scroll_stop(), so
+ * every flush fails with ESP_ERR_INVALID_STATE meanwhile and its changes stay dirty.
+ *
+ * @param i2c_ssd1306  Pointer to the SSD1306 handle.
+ * @param direction    Scroll direction.
+ * @param initial_page First page to scroll.
+ * @param final_page   Last page to scroll.
+ * @param speed        Interval between two steps.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the page range is invalid, or an error code otherwise.
+ */
+esp_err_t i2c_ssd1306_scroll_horizontal(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_scroll_direction_t direction, uint8_t initial_page, uint8_t final_page, ssd1306_scroll_speed_t speed);
+
+/**
+ * @brief Start a continuous vertical scroll of the SSD1306 display.
+ *
+ * Every 'speed' frames the rows of the vertical scroll area move up by 'vertical_offset' rows and pages
+ * 'initial_page'..'final_page' also move by one column in 'direction'. The horizontal part cannot be disabled;
+ * on panels shorter than 64 rows, pages below the panel (e.g. 4..7 on 32 rows) scroll vertically only. The same
+ * RAM restriction as for i2c_ssd1306_scroll_horizontal() applies.
+ *
+ * @param i2c_ssd1306     Pointer to the SSD1306 handle.
+ * @param direction       Direction of the horizontal part of the scroll.
+ * @param initial_page    First page of the horizontal part, up to 7.
+ * @param final_page      Last page of the horizontal part, up to 7.
+ * @param speed           Interval between two steps.
+ * @param vertical_offset Rows moved per step, less than the rows of the vertical scroll area.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if an argument is invalid, or an error code otherwise.
+ */
+esp_err_t i2c_ssd1306_scroll_vertical(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_scroll_direction_t direction, uint8_t initial_page, uint8_t final_page, ssd1306_scroll_speed_t speed, uint8_t vertical_offset);
+
+/**
+ * @brief Set the vertical scroll area used by the next i2c_ssd1306_scroll_vertical().
+ *
+ * The first 'fixed_rows' rows stay in place and the following 'scroll_rows' rows scroll. Defaults to the whole display.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param fixed_rows  Rows at the top that do not scroll.
+ * @param scroll_rows Rows that scroll.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the area does not fit the display.
+ */
+esp_err_t i2c_ssd1306_scroll_area(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t fixed_rows, uint8_t scroll_rows);
+
+/**
+ * @brief Stop the continuous scroll of the SSD1306 display.
+ *
+ * Deactivates the scroll and resets the display start line. The controller leaves the scrolled RAM content
+ * shifted, so the scrolled pages are marked dirty and the next dirty flush or present restores the framebuffer
+ * content. Stopping when no scroll runs only sends the deactivation.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, or an error code otherwise.
+ */
+esp_err_t i2c_ssd1306_scroll_stop(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Scroll a window of the SSD1306 display by one column.
+ *
+ * One-shot scroll of segments 'initial_segment'..'final_segment' of pages 'initial_page'..'final_page'. The
+ * same rotation is applied to the framebuffer, and the column that enters the window is marked dirty. To run a
+ * marquee, draw the next column there and flush it. Leave at least two frames between two steps.
+ *
+ * @param i2c_ssd1306     Pointer to the SSD1306 handle.
+ * @param direction       Scroll direction.
+ * @param initial_page    First page of the window.
+ * @param final_page      Last page of the window.
+ * @param initial_segment First segment of the window.
+ * @param final_segment   Last segment of the window.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if the window is invalid.
+ *   - ESP_ERR_INVALID_STATE if a continuous scroll runs.
+ */
+esp_err_t i2c_ssd1306_scroll_step(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_scroll_direction_t direction, uint8_t initial_page, uint8_t final_page, uint8_t initial_segment, uint8_t final_segment);
+
+/**
+ * @brief Create a flush scheduler for SSD1306 displays sharing one I2C bus.
+ *
+ * One task serves every display added with i2c_ssd1306_scheduler_add(). It interleaves the presented dirty
+ * windows of the displays round-robin, one budget-limited turn per display, so a display with a lot of
+ * changes cannot starve the others.
+ *
+ * @param scheduler_config Configuration of the scheduler.
+ * @param scheduler        Receives the created scheduler.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the budget is 0, ESP_ERR_NO_MEM if allocation failed.
+ */
+esp_err_t i2c_ssd1306_scheduler_create(const i2c_ssd1306_scheduler_config_t *scheduler_config, ssd1306_scheduler_t **scheduler);
+
+/**
+ * @brief Delete a flush scheduler.
+ *
+ * Removes every display still added, dropping what it had not sent yet, and deletes the task.
+ *
+ * @param scheduler Scheduler to delete.
+ *
+ * @return ESP_OK on success.
+ */
+esp_err_t i2c_ssd1306_scheduler_delete(ssd1306_scheduler_t *scheduler);
+
+/**
+ * @brief Add a display to a flush scheduler.
+ *
+ * Allocates a front buffer for the display. Afterwards the handle's framebuffer is the back buffer and
+ * i2c_ssd1306_present() hands frames over to the scheduler.
+ *
+ * @param scheduler   Scheduler to add the display to.
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_STATE if the display runs its own flush task, is in grayscale mode or a console, or is already
+ *     scheduled.
+ *   - ESP_ERR_NO_MEM if the scheduler is full or the front buffer could not be allocated.
+ */
+esp_err_t i2c_ssd1306_scheduler_add(ssd1306_scheduler_t *scheduler, i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Remove a display from its flush scheduler.
+ *
+ * Waits for the turn in flight, drops what the display had not sent yet and frees its front buffer.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the display is not scheduled.
+ */
+esp_err_t i2c_ssd1306_scheduler_remove(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Wait until a flush scheduler has sent everything presented to it.
+ *
+ * Windows of a display whose last transfer failed are retried with its next present and do not block the wait.
+ *
+ * @param scheduler Scheduler to wait for.
+ * @param timeout   Maximum time to wait, in ticks.
+ *
+ * @return
+ *   - The result of the last transfer (ESP_OK if none ran yet).
+ *   - ESP_ERR_TIMEOUT if windows are still pending after 'timeout'.
+ */
+esp_err_t i2c_ssd1306_scheduler_wait(ssd1306_scheduler_t *scheduler, TickType_t timeout);
+
+/**
+ * @brief Create a text label and draw it into the SSD1306 buffer.
+ *
+ * Text that does not fit the box is cut after the last whole glyph that does.
+ *
+ * @param widget      Widget to initialize.
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle the widget draws into.
+ * @param config      Box and style of the widget.
+ * @param text        Null-terminated UTF-8 text, copied into the widget.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if the box does not lie inside the panel or is lower than the font.
+ */
+esp_err_t i2c_ssd1306_widget_label(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, const char *text);
+
+/**
+ * @brief Create a numeric value and draw it into the SSD1306 buffer.
+ *
+ * The value is shown in decimal between 'prefix' and 'suffix', for example "Count: " and "" or "" and "°C".
+ *
+ * @param widget      Widget to initialize.
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle the widget draws into.
+ * @param config      Box and style of the widget.
+ * @param prefix      Text in front of the value, or NULL.
+ * @param suffix      Text behind the value, or NULL.
+ * @param value       Initial value.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if the box does not lie inside the panel or is lower than the font.
+ */
+esp_err_t i2c_ssd1306_widget_value(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, const char *prefix, const char *suffix, int32_t value);
+
+/**
+ * @brief Create an icon and draw it into the SSD1306 buffer.
+ *
+ * @param widget      Widget to initialize.
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle the widget draws into.
+ * @param config      Box and style of the widget; 'font' is ignored.
+ * @param sprite      Sprite shown in the box, or NULL for an empty box.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if the box does not lie inside the panel or the sprite does not fit it.
+ */
+esp_err_t i2c_ssd1306_widget_icon(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, const ssd1306_sprite_t *sprite);
+
+/**
+ * @brief Create a horizontal bar and draw it into the SSD1306 buffer.
+ *
+ * The bar is an outline with a one pixel gap around a fill proportional to 'value' in 'min'..'max'; values
+ * outside of the range are clamped.
+ *
+ * @param widget      Widget to initialize.
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle the widget draws into.
+ * @param config      Box and style of the widget; 'font' and 'align' are ignored.
+ * @param min         Value of an empty bar.
+ * @param max         Value of a full bar.
+ * @param value       Initial value.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if the box does not lie inside the panel, is smaller than 5x5 or 'min' >= 'max'.
+ */
+esp_err_t i2c_ssd1306_widget_bar(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, int32_t min, int32_t max, int32_t value);
+
+/**
+ * @brief Change the text of a label.
+ *
+ * Redraws the label's box only if the text changed; an unchanged text leaves the buffer and its dirty state alone.
+ *
+ * @param widget Label to update.
+ * @param text   Null-terminated UTF-8 text, copied into the widget.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the widget is not a label.
+ */
+esp_err_t i2c_ssd1306_widget_set_text(i2c_ssd1306_widget_t *widget, const char *text);
+
+/**
+ * @brief Change the value of a numeric value or bar.
+ *
+ * Redraws the widget's box only if what it shows changed.
+ *
+ * @param widget Value or bar to update.
+ * @param value  New value.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the widget is neither a value nor a bar.
+ */
+esp_err_t i2c_ssd1306_widget_set_value(i2c_ssd1306_widget_t *widget, int32_t value);
+
+/**
+ * @brief Change the sprite of an icon.
+ *
+ * Redraws the icon's box only if the sprite changed.
+ *
+ * @param widget Icon to update.
+ * @param sprite Sprite shown in the box, or NULL for an empty box.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the widget is not an icon or the sprite does not fit it.
+ */
+esp_err_t i2c_ssd1306_widget_set_sprite(i2c_ssd1306_widget_t *widget, const ssd1306_sprite_t *sprite);
+
+/**
+ * @brief Draw a widget's box again, for example after the buffer was cleared.
+ *
+ * @param widget Widget to draw.
  *
  * @return ESP_OK on success, or an error code otherwise.
  */
-esp_err_t i2c_ssd1306_buffer_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306);
\ No newline at end of file
+esp_err_t i2c_ssd1306_widget_redraw(i2c_ssd1306_widget_t *widget);
+
+/**
+ * @brief Initialize an empty display list.
+ *
+ * @param list     Display list to initialize.
+ * @param commands Storage for the recorded commands.
+ * @param capacity Number of commands 'commands' holds.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if 'commands' is NULL or 'capacity' is 0.
+ */
+esp_err_t i2c_ssd1306_list_init(ssd1306_list_t *list, ssd1306_list_command_t *commands, uint16_t capacity);
+
+/**
+ * @brief Remove every command from a display list, so that it can be recorded again.
+ *
+ * @param list Display list to reset.
+ */
+void i2c_ssd1306_list_reset(ssd1306_list_t *list);
+
+/*
+ * Recording functions. Each appends one command with the arguments of the buffer function it mirrors and returns
+ * ESP_ERR_NO_MEM, without logging, when the list is full; a list that overflowed is refused by submit until reset.
+ */
+esp_err_t i2c_ssd1306_list_clear(ssd1306_list_t *list, bool fill);
+esp_err_t i2c_ssd1306_list_pixel(ssd1306_list_t *list, int16_t x, int16_t y, bool fill);
+esp_err_t i2c_ssd1306_list_fill_rect(ssd1306_list_t *list, int16_t x, int16_t y, uint8_t w, uint8_t h, bool fill);
+esp_err_t i2c_ssd1306_list_rect(ssd1306_list_t *list, int16_t x, int16_t y, uint8_t w, uint8_t h, bool fill);
+esp_err_t i2c_ssd1306_list_line(ssd1306_list_t *list, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool fill);
+esp_err_t i2c_ssd1306_list_circle(ssd1306_list_t *list, int16_t cx, int16_t cy, uint8_t r, bool fill);
+esp_err_t i2c_ssd1306_list_fill_circle(ssd1306_list_t *list, int16_t cx, int16_t cy, uint8_t r, bool fill);
+esp_err_t i2c_ssd1306_list_text(ssd1306_list_t *list, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop);
+esp_err_t i2c_ssd1306_list_sprite(ssd1306_list_t *list, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop);
+
+/**
+ * @brief Execute a display list into the SSD1306 buffer.
+ *
+ * Runs every command in recording order. Commands are clipped to the panel instead of being rejected: text that
+ * starts outside of it is skipped. The list is kept, so a static screen is redrawn by submitting it again.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param list        Display list to execute.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if a command is invalid (missing text or sprite, unsupported raster operation); nothing is drawn.
+ *   - ESP_ERR_NO_MEM if the list overflowed while recording; nothing is drawn.
+ */
+esp_err_t i2c_ssd1306_list_submit(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_list_t *list);
+
+/**
+ * @brief Copy the flush telemetry of an SSD1306 handle.
+ *
+ * The counters are updated by whichever task flushes the display, without locking, so a snapshot taken while
+ * a flush runs may mix two frames.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param stats       Receives the telemetry.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if 'stats' is NULL.
+ */
+esp_err_t i2c_ssd1306_stats_get(const i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_stats_t *stats);
+
+/**
+ * @brief Clear the flush telemetry of an SSD1306 handle.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ */
+void i2c_ssd1306_stats_reset(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Frame latency below which 'percentile' percent of the frames completed.
+ *
+ * @param stats      Telemetry to evaluate.
+ * @param percentile Percentile, 1 to 100.
+ *
+ * @return Upper bound of the histogram bucket holding the percentile, capped at the worst frame latency, in
+ *         microseconds, or 0 without frames.
+ */
+uint32_t i2c_ssd1306_stats_latency_percentile(const ssd1306_stats_t *stats, uint8_t percentile);
+
+/**
+ * @brief Log the flush telemetry of an SSD1306 handle: counters, p50/p99 latency and the errors seen.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ */
+void i2c_ssd1306_stats_dump(const i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Find the fastest SCL rate the display runs at reliably, above the 400 kHz of i2c_ssd1306_init().
+ *
+ * Opt-in: i2c_ssd1306_init() keeps rejecting rates above 400 kHz, and only this function raises the rate. The
+ * SSD1306 cannot be read back over I2C, so a step passes when all transactions of its frame pushes are
+ * acknowledged. The settled rate is persisted in NVS (namespace "ssd1306", one key per device address), so later
+ * boots skip the sweep; NVS must be initialized by the application, otherwise the result is only applied.
+ * The framebuffer is pushed again at the settled rate, since failed steps may have left garbage in the display RAM.
+ *
+ * @param i2c_master_bus     The I2C master bus the display was initialized on.
+ * @param i2c_ssd1306        Pointer to the SSD1306 handle, initialized and not flushed by a task or scheduler.
+ * @param calibration_config Sweep parameters.
+ * @param scl_speed_hz       Receives the settled SCL rate, may be NULL.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if the sweep parameters are invalid.
+ *   - ESP_ERR_INVALID_STATE if the display is flushed by a task, a scheduler, the grayscale mode or a console.
+ *   - The error of the failing transaction if the display does not work even at 'start_hz'; the handle is
+ *     back at its previous rate.
+ *   - The error of i2c_master_bus_add_device() if the device could not be added back at any rate. Until a later
+ *     calibration adds it, transfers fail with ESP_ERR_INVALID_STATE; i2c_ssd1306_deinit() still succeeds.
+ */
+esp_err_t i2c_ssd1306_scl_calibrate(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_scl_calibration_config_t *calibration_config, uint32_t *scl_speed_hz);
+
+/**
+ * @brief Start the grayscale mode.
+ *
+ * The mode keeps two bitplanes of 2-bit gray levels and fakes the levels by frame-rate control: every gray cycle
+ * sends SSD1306_GRAY_SUBFRAMES full frames, and a pixel of level L is lit in L of them. A periodic timer wakes a
+ * dedicated flush task for every subframe, which composes the frame from the bitplanes and sends it, so the
+ * level drawn is only as steady as the flush is fast; see i2c_ssd1306_gray_get_stats().
+ *
+ * While the mode runs it owns the display's flushes: the 1bpp framebuffer stays available for drawing and
+ * i2c_ssd1306_gray_import(), but is not sent. The bitplanes start at level 0.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle, not flushed by a task or scheduler.
+ * @param gray_config Subframe rate and flush task settings.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if 'subframe_hz' is above i2c_ssd1306_gray_max_subframe_hz().
+ *   - ESP_ERR_INVALID_STATE if the display is flushed by a task, a scheduler or a console, or already in grayscale
+ *     mode.
+ *   - ESP_ERR_NO_MEM if the bitplanes, the timer or the task cannot be created.
+ */
+esp_err_t i2c_ssd1306_gray_start(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_gray_config_t *gray_config);
+
+/**
+ * @brief Highest subframe rate the grayscale mode can sustain on the display's SCL rate and addressing mode.
+ *
+ * Counts the 9 SCL periods of every byte of a full frame, the address bytes and the start and stop conditions,
+ * so it is an upper bound; leave some margin for clock stretching and other traffic on the bus.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return Subframes per second.
+ */
+uint32_t i2c_ssd1306_gray_max_subframe_hz(const i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Stop the grayscale mode after the subframe in flight and release its timer, task and bitplanes.
+ *
+ * The display keeps showing the last subframe until the next flush, which resends the whole 1bpp framebuffer.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the grayscale mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_stop(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Compose and send the next subframe from the calling task.
+ *
+ * For a grayscale mode started with a 'subframe_hz' of 0, whose subframes are paced by the application.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the mode is not running or runs its own timer, or the
+ *         error of the failed transaction.
+ */
+esp_err_t i2c_ssd1306_gray_step(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Show what was drawn into the gray bitplanes.
+ *
+ * Drawing goes to back bitplanes; this copies them to the bitplanes the subframes are composed from, between
+ * two subframes, so a gray cycle never shows a half-drawn picture.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the grayscale mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_present(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Set every pixel of the gray bitplanes to 'level'.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param level       Gray level, 0 to SSD1306_GRAY_LEVELS - 1.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for an invalid level, ESP_ERR_INVALID_STATE if the grayscale
+ *         mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_clear(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t level);
+
+/**
+ * @brief Set one pixel of the gray bitplanes to 'level'.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param x           X-coordinate of the pixel.
+ * @param y           Y-coordinate of the pixel.
+ * @param level       Gray level, 0 to SSD1306_GRAY_LEVELS - 1.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for a pixel outside of the panel or an invalid level,
+ *         ESP_ERR_INVALID_STATE if the grayscale mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, uint8_t level);
+
+/**
+ * @brief Set a rectangle of the gray bitplanes to 'level', clipped to the panel.
+ *
+ * Bar graphs are one call per bar and one for its empty part.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param x           X-coordinate of the rectangle's left column, may be negative.
+ * @param y           Y-coordinate of the rectangle's top row, may be negative.
+ * @param w           Width of the rectangle in pixels.
+ * @param h           Height of the rectangle in pixels.
+ * @param level       Gray level, 0 to SSD1306_GRAY_LEVELS - 1.
+ *
+ * @return ESP_OK on success, also when the rectangle lies outside of the panel, ESP_ERR_INVALID_ARG for an
+ *         invalid level, ESP_ERR_INVALID_STATE if the grayscale mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_fill_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t level);
+
+/**
+ * @brief Set every lit pixel of the 1bpp framebuffer to 'level' in the gray bitplanes.
+ *
+ * Text, shapes, sprites and image assets are drawn with the 1bpp functions into the handle's framebuffer and then
+ * imported at a gray level. Unlit pixels keep their level; the framebuffer itself is left as it is.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param level       Gray level, 0 to SSD1306_GRAY_LEVELS - 1.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for an invalid level, ESP_ERR_INVALID_STATE if the grayscale
+ *         mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_import(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t level);
+
+/**
+ * @brief Copy the refresh measurement of the grayscale mode.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param stats       Receives the measurement.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the grayscale mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_get_stats(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_gray_stats_t *stats);
+
+/**
+ * @brief Restart the refresh measurement of the grayscale mode.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the grayscale mode is not running.
+ */
+esp_err_t i2c_ssd1306_gray_reset_stats(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Start the text console.
+ *
+ * The console shows the last height / 8 lines of a terminal. Every line lives in its own page of the display RAM,
+ * which holds SSD1306_MAX_PAGES pages whatever the panel height, so a new line is drawn into the page below the
+ * visible ones and the display start line is moved by one page: a line costs one page of pixels and one command,
+ * however many lines are on screen, instead of a full frame. Lines wrap at the panel width and at
+ * SSD1306_CONSOLE_LINE_MAX - 1 bytes of UTF-8 text.
+ *
+ * While the console runs it owns the display RAM and its start line; the framebuffer stays available for drawing
+ * but must not be flushed. The console starts blank.
+ *
+ * @param i2c_ssd1306    Pointer to the SSD1306 handle, not flushed by a task or scheduler and not scrolling.
+ * @param console_config Font, backpressure policy and flush task settings.
+ *
+ * @return
+ *   - ESP_OK on success.
+ *   - ESP_ERR_INVALID_ARG if the font is not 8 pixels high.
+ *   - ESP_ERR_INVALID_STATE if the display is flushed by a task, a scheduler, the grayscale mode or already a
+ *     console, or a continuous scroll runs.
+ *   - ESP_ERR_NO_MEM if the console or its task cannot be created.
+ */
+esp_err_t i2c_ssd1306_console_start(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_console_config_t *console_config);
+
+/**
+ * @brief Stop the text console after the lines in flight and release its task.
+ *
+ * The start line goes back to 0 and the whole framebuffer is marked dirty, so the next flush restores the picture.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the console is not running, or the error of the start line
+ *         command.
+ */
+esp_err_t i2c_ssd1306_console_stop(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Append UTF-8 text to the console.
+ *
+ * '\n' ends a line; the next line only starts, and the display only scrolls, when text follows it. Other control
+ * characters are ignored. Without a flush task the changed lines are sent before returning; a failed send leaves
+ * them pending for the next write or i2c_ssd1306_console_flush().
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param text        Null-terminated UTF-8 string.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the console is not running, or the error of the first
+ *         failed send when the console has no flush task.
+ */
+esp_err_t i2c_ssd1306_console_write(i2c_ssd1306_handle_t *i2c_ssd1306, const char *text);
+
+/**
+ * @brief Append formatted text to the console, truncated to SSD1306_CONSOLE_PRINTF_MAX - 1 bytes.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param format      printf() format string.
+ *
+ * @return As i2c_ssd1306_console_write().
+ */
+esp_err_t i2c_ssd1306_console_printf(i2c_ssd1306_handle_t *i2c_ssd1306, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief Blank the console and move the cursor to the top line.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ *
+ * @return As i2c_ssd1306_console_write().
+ */
+esp_err_t i2c_ssd1306_console_clear(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/**
+ * @brief Wait until everything written to the console is on the display.
+ *
+ * Without a flush task the pending lines are sent from the calling task.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param timeout     Maximum time to wait for the flush task, in ticks.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the console is not running, ESP_ERR_TIMEOUT if the flush task
+ *         did not catch up in time, or the error of the failed send.
+ */
+esp_err_t i2c_ssd1306_console_flush(i2c_ssd1306_handle_t *i2c_ssd1306, TickType_t timeout);
+
+/**
+ * @brief Copy the counters of the text console.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param stats       Receives the counters.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the console is not running.
+ */
+esp_err_t i2c_ssd1306_console_get_stats(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_console_stats_t *stats);
@@ -0,0 +1,171 @@
+#include <stdlib.h>
+#include <esp_timer.h>
+#include "freertos/semphr.h"
+#include "ssd1306.h"
+#include "ssd1306_const.h"
+#include "ssd1306_internal.h"
+
+struct ssd1306_async
+{
+    TaskHandle_t task;
+    SemaphoreHandle_t idle;    // Given while no frame is in flight
+    uint8_t *front_storage;    // Front buffer, header included
+    uint8_t *front;            // Pixels of the front buffer
+    ssd1306_dirty_t window;    // Windows of the frame in flight
+    ssd1306_present_policy_t policy;
+    ssd1306_frame_done_cb_t on_frame_done;
+    void *user_ctx;
+    esp_err_t last_err;
+};
+
+static void ssd1306_flush_task(void *arg)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = (i2c_ssd1306_handle_t *)arg;
+    ssd1306_async_t *async = i2c_ssd1306->async;
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        int64_t start = esp_timer_get_time();
+        i2c_ssd1306->flush_wire_bytes = 0;
+        esp_err_t err = ssd1306_dirty_window_to_ram(i2c_ssd1306, async->front, &async->window);
+        ssd1306_stats_frame(i2c_ssd1306, start, err);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(SSD1306_TAG, "Failed to flush the front buffer to the RAM of the SSD1306 device");
+            /* Whatever was not sent goes out with the next frame. */
+        }
+        async->last_err = err;
+        if (async->on_frame_done)
+            async->on_frame_done(i2c_ssd1306, err, async->user_ctx);
+        xSemaphoreGive(async->idle);
+    }
+}
+
+esp_err_t i2c_ssd1306_async_start(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_async_config_t *async_config)
+{
+    if (i2c_ssd1306->async != NULL || i2c_ssd1306->scheduler != NULL || i2c_ssd1306->gray != NULL || i2c_ssd1306->console != NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 flush task is already running, or the display is scheduled, in grayscale mode or a console");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ssd1306_async_t *async = (ssd1306_async_t *)calloc(1, sizeof(ssd1306_async_t));
+    if (async == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 flush task");
+        return ESP_ERR_NO_MEM;
+    }
+    async->front_storage = (uint8_t *)calloc(1, SSD1306_FRAMEBUFFER_SIZE(i2c_ssd1306->width, i2c_ssd1306->height));
+    async->idle = xSemaphoreCreateBinary();
+    if (async->front_storage == NULL || async->idle == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 front buffer");
+        free(async->front_storage);
+        if (async->idle)
+            vSemaphoreDelete(async->idle);
+        free(async);
+        return ESP_ERR_NO_MEM;
+    }
+    async->front = async->front_storage + SSD1306_FRAMEBUFFER_HEADER;
+    async->front[-1] = OLED_CONTROL_BYTE_DATA;
+    async->policy = async_config->policy;
+    async->on_frame_done = async_config->on_frame_done;
+    async->user_ctx = async_config->user_ctx;
+    async->last_err = ESP_OK;
+    xSemaphoreGive(async->idle);
+
+    /* The front buffer starts blank; the first present copies everything that differs from it. */
+    ssd1306_mark_all_dirty(i2c_ssd1306);
+
+    i2c_ssd1306->async = async;
+    if (xTaskCreatePinnedToCore(ssd1306_flush_task, "ssd1306_flush", async_config->task_stack_size, i2c_ssd1306,
+                                async_config->task_priority, &async->task, async_config->task_core_id) != pdPASS)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to create the SSD1306 flush task");
+        i2c_ssd1306->async = NULL;
+        vSemaphoreDelete(async->idle);
+        free(async->front_storage);
+        free(async);
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_async_stop(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_async_t *async = i2c_ssd1306->async;
+    if (async == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 flush task is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* The task only blocks on its notification while idle, so it holds nothing when deleted. */
+    xSemaphoreTake(async->idle, portMAX_DELAY);
+    vTaskDelete(async->task);
+    vSemaphoreDelete(async->idle);
+    free(async->front_storage);
+    free(async);
+    i2c_ssd1306->async = NULL;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_present(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    if (i2c_ssd1306->scheduler)
+        return ssd1306_scheduler_present(i2c_ssd1306);
+
+    ssd1306_async_t *async = i2c_ssd1306->async;
+    if (async == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 flush task is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (i2c_ssd1306->dirty.pages == 0)
+        return ESP_OK;
+
+    TickType_t timeout = (async->policy == SSD1306_PRESENT_WAIT) ? portMAX_DELAY : 0;
+    if (xSemaphoreTake(async->idle, timeout) != pdTRUE)
+        return ESP_ERR_TIMEOUT;
+
+    /* Windows a failed flush left behind are still due, so they are merged instead of overwritten. */
+    ssd1306_dirty_copy(i2c_ssd1306, async->front, &async->window);
+    xTaskNotifyGive(async->task);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_async_wait(i2c_ssd1306_handle_t *i2c_ssd1306, TickType_t timeout)
+{
+    ssd1306_async_t *async = i2c_ssd1306->async;
+    if (async == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 flush task is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (xSemaphoreTake(async->idle, timeout) != pdTRUE)
+        return ESP_ERR_TIMEOUT;
+    xSemaphoreGive(async->idle);
+
+    return async->last_err;
+}
+
+uint8_t *ssd1306_front_acquire(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_dirty_t **pending, SemaphoreHandle_t *lock)
+{
+    if (i2c_ssd1306->scheduler)
+        return ssd1306_scheduler_front_acquire(i2c_ssd1306, pending, lock);
+
+    ssd1306_async_t *async = i2c_ssd1306->async;
+    if (async == NULL)
+        return NULL;
+    /* Holding 'idle' keeps present from handing the task a frame. */
+    xSemaphoreTake(async->idle, portMAX_DELAY);
+    *pending = &async->window;
+    *lock = async->idle;
+
+    return async->front;
+}
@@ -0,0 +1,474 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <esp_timer.h>
+#include "freertos/semphr.h"
+#include "ssd1306.h"
+#include "ssd1306_const.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Text console. Line n is kept in text slot n % SSD1306_MAX_PAGES and shown from the RAM page of the same number,
+ * so the display RAM is a ring of lines and scrolling is a matter of the display start line: the top visible line
+ * is the top row of the panel. A pass sends the changed pages of the visible lines and then moves the start line,
+ * so a new line is on the display before it scrolls in.
+ */
+
+struct ssd1306_console
+{
+    TaskHandle_t task;
+    SemaphoreHandle_t lock;      // Guards everything below but 'page_storage'
+    SemaphoreHandle_t idle;      // Given while no pass is on the bus
+    SemaphoreHandle_t progress;  // Given by the flush task after every pass
+    const ssd1306_font_t *font;
+    ssd1306_present_policy_t policy;
+    char text[SSD1306_MAX_PAGES][SSD1306_CONSOLE_LINE_MAX];
+    uint8_t length[SSD1306_MAX_PAGES];
+    uint16_t pen_x;              // Pen position on the cursor line, in pixels
+    uint32_t line;               // Number of the cursor line
+    uint32_t first_line;         // Top line since the last clear
+    bool newline_pending;        // A '\n' that starts the next line once text follows
+    uint8_t dirty_pages;         // RAM pages whose line changed since it was sent
+    uint8_t sent_start_line;     // Start line the display was set to, 0xFF before the first pass
+    ssd1306_console_stats_t stats;
+    uint32_t page_storage[SSD1306_FRAMEBUFFER_SIZE(SSD1306_MAX_WIDTH, 8) / sizeof(uint32_t)];
+};
+
+/* Line shown at the top of the panel. */
+static uint32_t ssd1306_console_top(const i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_console_t *console)
+{
+    uint8_t visible = i2c_ssd1306->height / 8;
+    return (console->line - console->first_line >= visible) ? console->line + 1 - visible : console->first_line;
+}
+
+/* Draw the text of 'slot' into the page buffer. */
+static uint8_t *ssd1306_console_render(const i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_console_t *console, uint8_t slot)
+{
+    uint8_t *page = (uint8_t *)console->page_storage + SSD1306_FRAMEBUFFER_HEADER;
+    memset(page, 0, i2c_ssd1306->width);
+
+    const char *text = console->text[slot];
+    uint16_t x = 0;
+    while (*text && x < i2c_ssd1306->width)
+    {
+        const ssd1306_glyph_t *glyph = ssd1306_font_glyph(console->font, ssd1306_utf8_next(&text));
+        uint16_t columns = (x + glyph->width < i2c_ssd1306->width) ? glyph->width : i2c_ssd1306->width - x;
+        memcpy(&page[x], &console->font->bitmaps[glyph->offset], columns);
+        x += glyph->advance;
+    }
+
+    return page;
+}
+
+/* Send one rendered line to 'ram_page', which may lie below the panel: the display RAM always has SSD1306_MAX_PAGES pages. */
+static esp_err_t ssd1306_console_page_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *page, uint8_t ram_page)
+{
+    if (i2c_ssd1306->scroll_pages)
+        return ESP_ERR_INVALID_STATE;
+
+    esp_err_t err;
+    if (i2c_ssd1306->addressing == SSD1306_ADDRESSING_HORIZONTAL)
+    {
+        uint8_t window_cmd[] = {
+            OLED_CONTROL_BYTE_CMD,
+            OLED_CMD_SET_COLUMN_ADDR_RANGE, 0x00, i2c_ssd1306->width - 1,
+            OLED_CMD_SET_PAGE_ADDR_RANGE, ram_page, ram_page};
+        err = ssd1306_transmit(i2c_ssd1306, window_cmd, sizeof(window_cmd));
+    }
+    else
+    {
+        uint8_t ram_addr_cmd[] = {
+            OLED_CONTROL_BYTE_CMD,
+            OLED_MASK_PAGE_ADDR | ram_page,
+            OLED_MASK_LSB_NIBBLE_SEG_ADDR | 0x00,
+            OLED_MASK_HSB_NIBBLE_SEG_ADDR | 0x00};
+        err = ssd1306_transmit(i2c_ssd1306, ram_addr_cmd, sizeof(ram_addr_cmd));
+    }
+    if (err != ESP_OK)
+        return err;
+
+    return ssd1306_transmit(i2c_ssd1306, page - 1, i2c_ssd1306->width + 1);
+}
+
+/* One pass: the changed pages of the visible lines, top to bottom, then the start line. The caller holds 'idle'. */
+static esp_err_t ssd1306_console_send(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    uint8_t visible = i2c_ssd1306->height / 8;
+
+    int64_t start = esp_timer_get_time();
+    i2c_ssd1306->flush_wire_bytes = 0;
+    esp_err_t err = ESP_OK;
+
+    xSemaphoreTake(console->lock, portMAX_DELAY);
+    uint32_t top = ssd1306_console_top(i2c_ssd1306, console);
+    xSemaphoreGive(console->lock);
+
+    for (uint32_t line = top; line < top + visible && err == ESP_OK; line++)
+    {
+        uint8_t ram_page = line % SSD1306_MAX_PAGES;
+        uint8_t *page = NULL;
+        xSemaphoreTake(console->lock, portMAX_DELAY);
+        if (console->dirty_pages & (1 << ram_page))
+        {
+            page = ssd1306_console_render(i2c_ssd1306, console, ram_page);
+            console->dirty_pages &= ~(1 << ram_page);
+        }
+        xSemaphoreGive(console->lock);
+        if (page == NULL)
+            continue;
+
+        /* The line may change again while it is on the bus; that only marks it dirty for the next pass. */
+        err = ssd1306_console_page_to_ram(i2c_ssd1306, page, ram_page);
+        xSemaphoreTake(console->lock, portMAX_DELAY);
+        if (err == ESP_OK)
+        {
+            console->stats.page_writes++;
+        }
+        else
+        {
+            console->dirty_pages |= 1 << ram_page;
+            console->stats.failed_writes++;
+        }
+        xSemaphoreGive(console->lock);
+    }
+
+    uint8_t start_line = (top % SSD1306_MAX_PAGES) * 8;
+    if (err == ESP_OK && start_line != console->sent_start_line)
+    {
+        uint8_t start_line_cmd[] = {OLED_CONTROL_BYTE_CMD, OLED_MASK_DISPLAY_START_LINE | start_line};
+        err = ssd1306_transmit(i2c_ssd1306, start_line_cmd, sizeof(start_line_cmd));
+        xSemaphoreTake(console->lock, portMAX_DELAY);
+        if (err == ESP_OK)
+            console->sent_start_line = start_line;
+        else
+            console->stats.failed_writes++;
+        xSemaphoreGive(console->lock);
+    }
+    ssd1306_stats_frame(i2c_ssd1306, start, err);
+
+    return err;
+}
+
+static esp_err_t ssd1306_console_send_now(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    xSemaphoreTake(console->idle, portMAX_DELAY);
+    esp_err_t err = ssd1306_console_send(i2c_ssd1306);
+    xSemaphoreGive(console->idle);
+
+    return err;
+}
+
+static void ssd1306_console_task(void *arg)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = (i2c_ssd1306_handle_t *)arg;
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    esp_err_t err = ESP_OK;
+
+    while (1)
+    {
+        /* After a failed pass, retry once the bus had time to recover, even if nothing new is written. */
+        ulTaskNotifyTake(pdTRUE, (err == ESP_OK) ? portMAX_DELAY : pdMS_TO_TICKS(I2C_SSD1306_TIMEOUT_MS));
+        err = ssd1306_console_send_now(i2c_ssd1306);
+        if (err != ESP_OK)
+            ESP_LOGE(SSD1306_TAG, "Failed to send the console lines to the SSD1306 device");
+        xSemaphoreGive(console->progress);
+    }
+}
+
+/*
+ * Start the line after the cursor line, scrolling the top line away once the panel is full. Called with 'lock'
+ * held; it is released while waiting for the top line to be sent.
+ */
+static esp_err_t ssd1306_console_newline(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_console_t *console)
+{
+    esp_err_t err = ESP_OK;
+    uint8_t visible = i2c_ssd1306->height / 8;
+    if (console->line + 1 - console->first_line >= visible)
+    {
+        uint8_t leaving = 1 << ((console->line + 1 - visible) % SSD1306_MAX_PAGES);
+        while ((console->dirty_pages & leaving) && console->policy == SSD1306_PRESENT_WAIT)
+        {
+            xSemaphoreGive(console->lock);
+            if (console->task)
+            {
+                xTaskNotifyGive(console->task);
+                xSemaphoreTake(console->progress, portMAX_DELAY);
+            }
+            else
+            {
+                err = ssd1306_console_send_now(i2c_ssd1306);
+            }
+            xSemaphoreTake(console->lock, portMAX_DELAY);
+            if (err != ESP_OK)
+                break;
+        }
+        if (console->dirty_pages & leaving)
+        {
+            console->dirty_pages &= ~leaving;
+            console->stats.dropped_lines++;
+        }
+    }
+
+    console->line++;
+    uint8_t slot = console->line % SSD1306_MAX_PAGES;
+    console->text[slot][0] = '\0';
+    console->length[slot] = 0;
+    console->pen_x = 0;
+    console->dirty_pages |= 1 << slot;
+    console->stats.lines++;
+
+    return err;
+}
+
+/* Append the 'size' bytes of 'sequence', which encode 'code_point', to the cursor line. Called with 'lock' held. */
+static esp_err_t ssd1306_console_put(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_console_t *console, const char *sequence, uint8_t size, uint32_t code_point)
+{
+    esp_err_t err = ESP_OK;
+    if (code_point == '\n')
+    {
+        if (console->newline_pending)
+            err = ssd1306_console_newline(i2c_ssd1306, console);
+        console->newline_pending = true;
+        return err;
+    }
+    if (code_point < 0x20 || code_point == 0x7F)
+        return err;
+
+    const ssd1306_glyph_t *glyph = ssd1306_font_glyph(console->font, code_point);
+    uint8_t slot = console->line % SSD1306_MAX_PAGES;
+    if (console->newline_pending || (console->length[slot] > 0 && console->pen_x + glyph->width > i2c_ssd1306->width) ||
+        console->length[slot] + size >= SSD1306_CONSOLE_LINE_MAX)
+    {
+        console->newline_pending = false;
+        err = ssd1306_console_newline(i2c_ssd1306, console);
+        slot = console->line % SSD1306_MAX_PAGES;
+    }
+    memcpy(&console->text[slot][console->length[slot]], sequence, size);
+    console->length[slot] += size;
+    console->text[slot][console->length[slot]] = '\0';
+    console->pen_x += glyph->advance;
+    console->dirty_pages |= 1 << slot;
+
+    return err;
+}
+
+/* Get the changes on their way: wake the flush task, or send them now and return the first error of the write. */
+static esp_err_t ssd1306_console_commit(i2c_ssd1306_handle_t *i2c_ssd1306, esp_err_t err)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    if (console->task)
+    {
+        xTaskNotifyGive(console->task);
+        return ESP_OK;
+    }
+
+    esp_err_t send_err = ssd1306_console_send_now(i2c_ssd1306);
+    return (err != ESP_OK) ? err : send_err;
+}
+
+static void ssd1306_console_free(ssd1306_console_t *console)
+{
+    if (console->lock)
+        vSemaphoreDelete(console->lock);
+    if (console->idle)
+        vSemaphoreDelete(console->idle);
+    if (console->progress)
+        vSemaphoreDelete(console->progress);
+    free(console);
+}
+
+esp_err_t i2c_ssd1306_console_start(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_console_config_t *console_config)
+{
+    if (i2c_ssd1306->async != NULL || i2c_ssd1306->scheduler != NULL || i2c_ssd1306->gray != NULL || i2c_ssd1306->console != NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 flush task, a scheduler, the grayscale mode or a console already owns the display");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (i2c_ssd1306->scroll_pages)
+    {
+        ESP_LOGE(SSD1306_TAG, "A continuous scroll of the SSD1306 device is running");
+        return ESP_ERR_INVALID_STATE;
+    }
+    const ssd1306_font_t *font = console_config->font ? console_config->font : &ssd1306_font_8x8;
+    if (font->height != 8)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid console font, it must be 8 pixels high");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_console_t *console = (ssd1306_console_t *)calloc(1, sizeof(ssd1306_console_t));
+    if (console == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 console");
+        return ESP_ERR_NO_MEM;
+    }
+    console->lock = xSemaphoreCreateMutex();
+    console->idle = xSemaphoreCreateBinary();
+    console->progress = xSemaphoreCreateBinary();
+    if (console->lock == NULL || console->idle == NULL || console->progress == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to create the SSD1306 console semaphores");
+        ssd1306_console_free(console);
+        return ESP_ERR_NO_MEM;
+    }
+    console->font = font;
+    console->policy = console_config->policy;
+    console->dirty_pages = (uint8_t)(0xFF >> (SSD1306_MAX_PAGES - i2c_ssd1306->total_pages));
+    console->sent_start_line = 0xFF;
+    ((uint8_t *)console->page_storage)[SSD1306_FRAMEBUFFER_HEADER - 1] = OLED_CONTROL_BYTE_DATA;
+    xSemaphoreGive(console->idle);
+
+    i2c_ssd1306->console = console;
+    if (console_config->task_stack_size == 0)
+        return ESP_OK;
+
+    if (xTaskCreatePinnedToCore(ssd1306_console_task, "ssd1306_console", console_config->task_stack_size, i2c_ssd1306,
+                                console_config->task_priority, &console->task, console_config->task_core_id) != pdPASS)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to create the SSD1306 console flush task");
+        i2c_ssd1306->console = NULL;
+        ssd1306_console_free(console);
+        return ESP_ERR_NO_MEM;
+    }
+    /* Blank the visible lines right away. */
+    xTaskNotifyGive(console->task);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_console_stop(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    if (console == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 console is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* The task only blocks on its notification between passes, so it holds nothing once 'idle' is taken. */
+    xSemaphoreTake(console->idle, portMAX_DELAY);
+    if (console->task)
+        vTaskDelete(console->task);
+    i2c_ssd1306->console = NULL;
+    ssd1306_console_free(console);
+
+    uint8_t start_line_cmd[] = {OLED_CONTROL_BYTE_CMD, OLED_MASK_DISPLAY_START_LINE | 0x00};
+    esp_err_t err = ssd1306_transmit(i2c_ssd1306, start_line_cmd, sizeof(start_line_cmd));
+    if (err != ESP_OK)
+        ESP_LOGE(SSD1306_TAG, "Failed to reset the display start line of the SSD1306 device");
+    ssd1306_mark_all_dirty(i2c_ssd1306);
+
+    return err;
+}
+
+esp_err_t i2c_ssd1306_console_write(i2c_ssd1306_handle_t *i2c_ssd1306, const char *text)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    if (console == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 console is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(console->lock, portMAX_DELAY);
+    while (*text)
+    {
+        const char *sequence = text;
+        uint32_t code_point = ssd1306_utf8_next(&text);
+        esp_err_t put_err = ssd1306_console_put(i2c_ssd1306, console, sequence, text - sequence, code_point);
+        if (err == ESP_OK)
+            err = put_err;
+    }
+    xSemaphoreGive(console->lock);
+
+    return ssd1306_console_commit(i2c_ssd1306, err);
+}
+
+esp_err_t i2c_ssd1306_console_printf(i2c_ssd1306_handle_t *i2c_ssd1306, const char *format, ...)
+{
+    char text[SSD1306_CONSOLE_PRINTF_MAX];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    return i2c_ssd1306_console_write(i2c_ssd1306, text);
+}
+
+esp_err_t i2c_ssd1306_console_clear(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    if (console == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 console is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* A fresh line at the top; the visible lines after it are blank, so the old ones are never sent again. */
+    xSemaphoreTake(console->lock, portMAX_DELAY);
+    console->line++;
+    console->first_line = console->line;
+    console->newline_pending = false;
+    console->pen_x = 0;
+    console->dirty_pages = 0;
+    for (uint8_t slot = 0; slot < SSD1306_MAX_PAGES; slot++)
+    {
+        console->text[slot][0] = '\0';
+        console->length[slot] = 0;
+    }
+    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+        console->dirty_pages |= 1 << ((console->line + i) % SSD1306_MAX_PAGES);
+    console->stats.lines++;
+    xSemaphoreGive(console->lock);
+
+    return ssd1306_console_commit(i2c_ssd1306, ESP_OK);
+}
+
+esp_err_t i2c_ssd1306_console_flush(i2c_ssd1306_handle_t *i2c_ssd1306, TickType_t timeout)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    if (console == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 console is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (console->task == NULL)
+        return ssd1306_console_send_now(i2c_ssd1306);
+
+    TickType_t start = xTaskGetTickCount();
+    while (1)
+    {
+        xSemaphoreTake(console->lock, portMAX_DELAY);
+        uint8_t start_line = (ssd1306_console_top(i2c_ssd1306, console) % SSD1306_MAX_PAGES) * 8;
+        bool pending = console->dirty_pages != 0 || console->sent_start_line != start_line;
+        xSemaphoreGive(console->lock);
+        if (!pending)
+            return ESP_OK;
+
+        xTaskNotifyGive(console->task);
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (timeout != portMAX_DELAY && elapsed >= timeout)
+            return ESP_ERR_TIMEOUT;
+        if (xSemaphoreTake(console->progress, (timeout == portMAX_DELAY) ? portMAX_DELAY : timeout - elapsed) != pdTRUE)
+            return ESP_ERR_TIMEOUT;
+    }
+}
+
+esp_err_t i2c_ssd1306_console_get_stats(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_console_stats_t *stats)
+{
+    ssd1306_console_t *console = i2c_ssd1306->console;
+    if (console == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 console is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(console->lock, portMAX_DELAY);
+    *stats = console->stats;
+    xSemaphoreGive(console->lock);
+
+    return ESP_OK;
+}
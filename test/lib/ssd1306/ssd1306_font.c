@@ -0,0 +1,57 @@
+#include "ssd1306.h"
+#include "ssd1306_internal.h"
+
+uint32_t ssd1306_utf8_next(const char **text)
+{
+    const uint8_t *s = (const uint8_t *)*text;
+    uint32_t code_point;
+    uint8_t continuation;
+    if (s[0] < 0x80)
+    {
+        *text += 1;
+        return s[0];
+    }
+    else if ((s[0] & 0xE0) == 0xC0)
+    {
+        code_point = s[0] & 0x1F;
+        continuation = 1;
+    }
+    else if ((s[0] & 0xF0) == 0xE0)
+    {
+        code_point = s[0] & 0x0F;
+        continuation = 2;
+    }
+    else if ((s[0] & 0xF8) == 0xF0)
+    {
+        code_point = s[0] & 0x07;
+        continuation = 3;
+    }
+    else
+    {
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    for (uint8_t i = 1; i <= continuation; i++)
+    {
+        /* Stops at the terminator too, which is not a continuation byte. */
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *text += i;
+            return 0xFFFD;
+        }
+        code_point = (code_point << 6) | (s[i] & 0x3F);
+    }
+    *text += continuation + 1;
+
+    return code_point;
+}
+
+uint16_t ssd1306_font_text_width(const ssd1306_font_t *font, const char *text)
+{
+    uint16_t width = 0;
+    while (*text)
+        width += ssd1306_font_glyph(font, ssd1306_utf8_next(&text))->advance;
+
+    return width;
+}
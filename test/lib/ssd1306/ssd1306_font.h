@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Compact SSD1306 fonts, generated by tools/ssd1306_fontgen.py from BDF or TrueType fonts.
+ *
+ * Only the code point ranges a font was generated for are stored. Every glyph is a stack of 'height / 8'
+ * page-major strips of 'width' column bytes (LSB at the top), the same layout as a framebuffer page, so a strip is
+ * blitted into the framebuffer without any reshaping. Columns between 'width' and 'advance' are blank and not stored.
+ * Fonts that are not referenced are dropped by the linker.
+ */
+
+/**
+ * @brief Glyph of a compact font.
+ *
+ * The strips start at 'offset' in the font bitmaps and hold 'width' columns each; the pen then moves by 'advance'.
+ */
+typedef struct
+{
+    uint16_t offset;
+    uint8_t width;
+    uint8_t advance;
+} ssd1306_glyph_t;
+
+/**
+ * @brief Code points 'first'..'first + count - 1' mapped to glyphs 'glyph'..'glyph + count - 1'.
+ */
+typedef struct
+{
+    uint16_t first;
+    uint16_t count;
+    uint16_t glyph;
+} ssd1306_font_range_t;
+
+/**
+ * @brief Compact font.
+ *
+ * 'height' is a multiple of 8. Code points outside of the sorted 'ranges' are drawn with glyph 'fallback'.
+ */
+typedef struct
+{
+    uint8_t height;
+    uint8_t range_count;
+    uint16_t fallback;
+    const ssd1306_font_range_t *ranges;
+    const ssd1306_glyph_t *glyphs;
+    const uint8_t *bitmaps;
+} ssd1306_font_t;
+
+/* Monospace 8x8 ASCII font of i2c_ssd1306_buffer_text(), and its proportional cut. */
+extern const ssd1306_font_t ssd1306_font_8x8;
+extern const ssd1306_font_t ssd1306_font_8;
+/* DejaVu Sans Bold, ASCII and the degree sign. */
+extern const ssd1306_font_t ssd1306_font_16;
+extern const ssd1306_font_t ssd1306_font_24;
+
+/* Glyph of 'code_point', or the fallback glyph when the font does not cover it. */
+static inline const ssd1306_glyph_t *ssd1306_font_glyph(const ssd1306_font_t *font, uint32_t code_point)
+{
+    for (uint8_t i = 0; i < font->range_count; i++)
+    {
+        /* Code points below 'first' wrap around and fail the count check too. */
+        uint32_t index = code_point - font->ranges[i].first;
+        if (index < font->ranges[i].count)
+            return &font->glyphs[font->ranges[i].glyph + index];
+    }
+    return &font->glyphs[font->fallback];
+}
+
+/**
+ * @brief Width of a UTF-8 string rendered with a compact font.
+ *
+ * @param font Font the text is rendered with.
+ * @param text Null-terminated UTF-8 string.
+ *
+ * @return Sum of the glyph advances, in pixels.
+ */
+uint16_t ssd1306_font_text_width(const ssd1306_font_t *font, const char *text);
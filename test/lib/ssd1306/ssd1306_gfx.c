@@ -0,0 +1,357 @@
+#include <math.h>
+#include "ssd1306.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Shape primitives. Every shape is broken into vertical spans (one column, a range of rows) or horizontal spans
+ * (one row, a range of columns), which are clipped once and written with the per-page byte masks of
+ * ssd1306_fill_rect(). Coordinates are signed so that shapes may extend past the panel; the dirty window is
+ * marked once per shape with its clipped bounding box.
+ */
+
+static inline int32_t ssd1306_clamp(int32_t value, int32_t low, int32_t high)
+{
+    return (value < low) ? low : (value > high) ? high : value;
+}
+
+static void ssd1306_vspan(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x, int32_t y1, int32_t y2, bool fill)
+{
+    if (y1 > y2)
+    {
+        int32_t swap = y1;
+        y1 = y2;
+        y2 = swap;
+    }
+    if (x < 0 || x >= i2c_ssd1306->width || y2 < 0 || y1 >= i2c_ssd1306->height)
+        return;
+    ssd1306_fill_rect(i2c_ssd1306, x, x, ssd1306_clamp(y1, 0, i2c_ssd1306->height - 1), ssd1306_clamp(y2, 0, i2c_ssd1306->height - 1), fill);
+}
+
+static void ssd1306_hspan(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x1, int32_t x2, int32_t y, bool fill)
+{
+    if (x1 > x2)
+    {
+        int32_t swap = x1;
+        x1 = x2;
+        x2 = swap;
+    }
+    if (y < 0 || y >= i2c_ssd1306->height || x2 < 0 || x1 >= i2c_ssd1306->width)
+        return;
+    ssd1306_fill_rect(i2c_ssd1306, ssd1306_clamp(x1, 0, i2c_ssd1306->width - 1), ssd1306_clamp(x2, 0, i2c_ssd1306->width - 1), y, y, fill);
+}
+
+static void ssd1306_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x1, int32_t x2, int32_t y1, int32_t y2, bool fill)
+{
+    if (x1 > x2 || y1 > y2 || x2 < 0 || y2 < 0 || x1 >= i2c_ssd1306->width || y1 >= i2c_ssd1306->height)
+        return;
+    ssd1306_fill_rect(i2c_ssd1306, ssd1306_clamp(x1, 0, i2c_ssd1306->width - 1), ssd1306_clamp(x2, 0, i2c_ssd1306->width - 1),
+                      ssd1306_clamp(y1, 0, i2c_ssd1306->height - 1), ssd1306_clamp(y2, 0, i2c_ssd1306->height - 1), fill);
+}
+
+static void ssd1306_mark_box(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x1, int32_t x2, int32_t y1, int32_t y2)
+{
+    if (x1 > x2 || y1 > y2 || x2 < 0 || y2 < 0 || x1 >= i2c_ssd1306->width || y1 >= i2c_ssd1306->height)
+        return;
+    x1 = ssd1306_clamp(x1, 0, i2c_ssd1306->width - 1);
+    x2 = ssd1306_clamp(x2, 0, i2c_ssd1306->width - 1);
+    ssd1306_mark_dirty(i2c_ssd1306, ssd1306_clamp(y1, 0, i2c_ssd1306->height - 1) / 8, ssd1306_clamp(y2, 0, i2c_ssd1306->height - 1) / 8, x1, x2);
+}
+
+/* Bresenham line, emitted as horizontal runs for shallow lines and vertical runs for steep ones. */
+static void ssd1306_line(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x1, int32_t y1, int32_t x2, int32_t y2, bool fill)
+{
+    int32_t dx = (x2 > x1) ? x2 - x1 : x1 - x2;
+    int32_t dy = (y2 > y1) ? y1 - y2 : y2 - y1;
+    int32_t sx = (x1 < x2) ? 1 : -1;
+    int32_t sy = (y1 < y2) ? 1 : -1;
+    int32_t err = dx + dy;
+    bool steep = -dy > dx;
+    int32_t run_x = x1;
+    int32_t run_y = y1;
+    while (x1 != x2 || y1 != y2)
+    {
+        int32_t e2 = 2 * err;
+        bool step_x = e2 >= dy;
+        bool step_y = e2 <= dx;
+        /* A run ends when the minor axis is about to step. */
+        bool run_ends = steep ? step_x : step_y;
+        if (run_ends)
+        {
+            if (steep)
+                ssd1306_vspan(i2c_ssd1306, x1, run_y, y1, fill);
+            else
+                ssd1306_hspan(i2c_ssd1306, run_x, x1, y1, fill);
+        }
+        if (step_x)
+        {
+            err += dy;
+            x1 += sx;
+        }
+        if (step_y)
+        {
+            err += dx;
+            y1 += sy;
+        }
+        if (run_ends)
+        {
+            run_x = x1;
+            run_y = y1;
+        }
+    }
+    if (steep)
+        ssd1306_vspan(i2c_ssd1306, x1, run_y, y1, fill);
+    else
+        ssd1306_hspan(i2c_ssd1306, run_x, x1, y1, fill);
+}
+
+/* Sweep of an arc: start and end directions scaled by 1024, angles growing clockwise on screen. */
+typedef struct
+{
+    int32_t start_x;
+    int32_t start_y;
+    int32_t end_x;
+    int32_t end_y;
+    bool wide;
+} ssd1306_sweep_t;
+
+static bool ssd1306_in_sweep(const ssd1306_sweep_t *sweep, int32_t dx, int32_t dy)
+{
+    bool after_start = sweep->start_x * dy - sweep->start_y * dx >= 0;
+    bool before_end = dx * sweep->end_y - dy * sweep->end_x >= 0;
+
+    return sweep->wide ? (after_start || before_end) : (after_start && before_end);
+}
+
+/* Vertical span of a round shape, split into the runs of pixels inside 'sweep' when there is one. */
+static void ssd1306_round_vspan(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x, int32_t y1, int32_t y2, int32_t cx, int32_t cy, const ssd1306_sweep_t *sweep, bool fill)
+{
+    if (sweep == NULL)
+    {
+        ssd1306_vspan(i2c_ssd1306, x, y1, y2, fill);
+        return;
+    }
+    bool in_run = false;
+    int32_t run = y1;
+    for (int32_t y = y1; y <= y2 + 1; y++)
+    {
+        bool inside = y <= y2 && ssd1306_in_sweep(sweep, x - cx, y - cy);
+        if (inside && !in_run)
+            run = y;
+        else if (!inside && in_run)
+            ssd1306_vspan(i2c_ssd1306, x, run, y - 1, fill);
+        in_run = inside;
+    }
+}
+
+/*
+ * Circle of radius 'r' split at its centre lines and stretched apart: the left half is centred on 'left', the right
+ * half on 'right', the upper half on 'top' and the lower half on 'bottom'. That is a circle when they are equal and
+ * a rounded rectangle otherwise. Every column is one span when filled; the outline takes, per column, the rows the
+ * boundary crosses before it reaches the next column, so it is drawn without gaps.
+ */
+static void ssd1306_round(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t left, int32_t right, int32_t top, int32_t bottom, int32_t r, bool filled, const ssd1306_sweep_t *sweep, bool fill)
+{
+    int32_t limit = r * r + r;
+    int32_t height = r;
+    for (int32_t dx = 0; dx <= r; dx++)
+    {
+        /* Half height of the next column, -1 past the last one. */
+        int32_t next = height;
+        while (next >= 0 && (dx + 1) * (dx + 1) + next * next > limit)
+            next--;
+
+        int32_t columns[2] = {left - dx, right + dx};
+        for (uint8_t i = 0; i < ((columns[0] == columns[1]) ? 1 : 2); i++)
+        {
+            int32_t cx = i ? right : left;
+            int32_t inner = (next + 1 < height) ? next + 1 : height;
+            if (filled || inner == 0)
+                ssd1306_round_vspan(i2c_ssd1306, columns[i], top - height, bottom + height, cx, top, sweep, fill);
+            else
+            {
+                ssd1306_round_vspan(i2c_ssd1306, columns[i], top - height, top - inner, cx, top, sweep, fill);
+                ssd1306_round_vspan(i2c_ssd1306, columns[i], bottom + inner, bottom + height, cx, bottom, sweep, fill);
+            }
+        }
+        height = next;
+    }
+
+    if (right - left > 1)
+    {
+        if (filled)
+            ssd1306_rect(i2c_ssd1306, left + 1, right - 1, top - r, bottom + r, fill);
+        else
+        {
+            ssd1306_hspan(i2c_ssd1306, left + 1, right - 1, top - r, fill);
+            ssd1306_hspan(i2c_ssd1306, left + 1, right - 1, bottom + r, fill);
+        }
+    }
+    ssd1306_mark_box(i2c_ssd1306, left - r, right + r, top - r, bottom + r);
+}
+
+/* Column-scan fill: in every column the rows whose centres lie between pairs of edge crossings are filled. */
+static void ssd1306_polygon_fill(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_point_t *points, uint8_t count, int32_t x1, int32_t x2, bool fill)
+{
+    int32_t crossings[SSD1306_POLYGON_MAX_POINTS];
+    for (int32_t x = (x1 < 0) ? 0 : x1; x <= x2 && x < i2c_ssd1306->width; x++)
+    {
+        uint8_t found = 0;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const ssd1306_point_t *a = &points[i];
+            const ssd1306_point_t *b = &points[(i + 1) % count];
+            /* Half-open in x so that a vertex shared by two edges is crossed once. */
+            if ((a->x <= x && x < b->x) || (b->x <= x && x < a->x))
+            {
+                /* Crossing row in 1/256 pixels. */
+                int32_t y = a->y * 256 + (int32_t)((int64_t)(x - a->x) * (b->y - a->y) * 256 / (b->x - a->x));
+                uint8_t j = found++;
+                for (; j > 0 && crossings[j - 1] > y; j--)
+                    crossings[j] = crossings[j - 1];
+                crossings[j] = y;
+            }
+        }
+        for (uint8_t i = 0; i + 1 < found; i += 2)
+        {
+            int32_t y1 = (crossings[i] + 255) >> 8;
+            int32_t y2 = ((crossings[i + 1] + 255) >> 8) - 1;
+            if (y1 <= y2)
+                ssd1306_vspan(i2c_ssd1306, x, y1, y2, fill);
+        }
+    }
+}
+
+static esp_err_t ssd1306_polygon(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_point_t *points, uint8_t count, bool filled, bool fill)
+{
+    if (points == NULL || count < 2 || count > SSD1306_POLYGON_MAX_POINTS)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid polygon, 'points' must hold between 2 and %d points", SSD1306_POLYGON_MAX_POINTS);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int32_t x1 = points[0].x, x2 = points[0].x, y1 = points[0].y, y2 = points[0].y;
+    for (uint8_t i = 1; i < count; i++)
+    {
+        x1 = (points[i].x < x1) ? points[i].x : x1;
+        x2 = (points[i].x > x2) ? points[i].x : x2;
+        y1 = (points[i].y < y1) ? points[i].y : y1;
+        y2 = (points[i].y > y2) ? points[i].y : y2;
+    }
+    if (filled)
+        ssd1306_polygon_fill(i2c_ssd1306, points, count, x1, x2, fill);
+    /* The outline is drawn for filled polygons too, the fill alone leaves out the right and bottom edges. */
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const ssd1306_point_t *a = &points[i];
+        const ssd1306_point_t *b = &points[(i + 1) % count];
+        ssd1306_line(i2c_ssd1306, a->x, a->y, b->x, b->y, fill);
+    }
+    ssd1306_mark_box(i2c_ssd1306, x1, x2, y1, y2);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_buffer_hline(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint16_t length, bool fill)
+{
+    if (length == 0)
+        return ESP_OK;
+    ssd1306_hspan(i2c_ssd1306, x, x + length - 1, y, fill);
+    ssd1306_mark_box(i2c_ssd1306, x, x + length - 1, y, y);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_buffer_vline(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint16_t length, bool fill)
+{
+    if (length == 0)
+        return ESP_OK;
+    ssd1306_vspan(i2c_ssd1306, x, y, y + length - 1, fill);
+    ssd1306_mark_box(i2c_ssd1306, x, x, y, y + length - 1);
+
+    return ESP_OK;
+}
+
+void ssd1306_draw_line(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x1, int32_t y1, int32_t x2, int32_t y2, bool fill)
+{
+    ssd1306_line(i2c_ssd1306, x1, y1, x2, y2, fill);
+    ssd1306_mark_box(i2c_ssd1306, (x1 < x2) ? x1 : x2, (x1 < x2) ? x2 : x1, (y1 < y2) ? y1 : y2, (y1 < y2) ? y2 : y1);
+}
+
+void ssd1306_draw_circle(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t cx, int32_t cy, int32_t r, bool filled, bool fill)
+{
+    ssd1306_round(i2c_ssd1306, cx, cx, cy, cy, r, filled, NULL, fill);
+}
+
+esp_err_t i2c_ssd1306_buffer_line(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool fill)
+{
+    ssd1306_draw_line(i2c_ssd1306, x1, y1, x2, y2, fill);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_buffer_circle(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t cx, int16_t cy, uint8_t r, bool fill)
+{
+    ssd1306_draw_circle(i2c_ssd1306, cx, cy, r, false, fill);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_buffer_fill_circle(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t cx, int16_t cy, uint8_t r, bool fill)
+{
+    ssd1306_draw_circle(i2c_ssd1306, cx, cy, r, true, fill);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_buffer_arc(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t cx, int16_t cy, uint8_t r, int16_t start_angle, int16_t end_angle, bool fill)
+{
+    int32_t span = end_angle - start_angle;
+    if (span <= -360 || span >= 360)
+        return i2c_ssd1306_buffer_circle(i2c_ssd1306, cx, cy, r, fill);
+    span = (span + 360) % 360;
+
+    const float deg_to_rad = 3.14159265f / 180.0f;
+    ssd1306_sweep_t sweep = {
+        .start_x = (int32_t)lroundf(cosf(start_angle * deg_to_rad) * 1024.0f),
+        .start_y = (int32_t)lroundf(sinf(start_angle * deg_to_rad) * 1024.0f),
+        .end_x = (int32_t)lroundf(cosf(end_angle * deg_to_rad) * 1024.0f),
+        .end_y = (int32_t)lroundf(sinf(end_angle * deg_to_rad) * 1024.0f),
+        .wide = span > 180};
+    ssd1306_round(i2c_ssd1306, cx, cx, cy, cy, r, false, &sweep, fill);
+
+    return ESP_OK;
+}
+
+/* Corner radius that fits a w x h rectangle, and the stretched circle that draws it. */
+static void ssd1306_round_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t r, bool filled, bool fill)
+{
+    if (w == 0 || h == 0)
+        return;
+    uint8_t max_r = ((w < h) ? w - 1 : h - 1) / 2;
+    r = (r < max_r) ? r : max_r;
+    ssd1306_round(i2c_ssd1306, x + r, x + w - 1 - r, y + r, y + h - 1 - r, r, filled, NULL, fill);
+}
+
+esp_err_t i2c_ssd1306_buffer_round_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t r, bool fill)
+{
+    ssd1306_round_rect(i2c_ssd1306, x, y, w, h, r, false, fill);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_buffer_fill_round_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t r, bool fill)
+{
+    ssd1306_round_rect(i2c_ssd1306, x, y, w, h, r, true, fill);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_buffer_polygon(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_point_t *points, uint8_t count, bool fill)
+{
+    return ssd1306_polygon(i2c_ssd1306, points, count, false, fill);
+}
+
+esp_err_t i2c_ssd1306_buffer_fill_polygon(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_point_t *points, uint8_t count, bool fill)
+{
+    return ssd1306_polygon(i2c_ssd1306, points, count, true, fill);
+}
@@ -0,0 +1,426 @@
+#include <stdlib.h>
+#include <esp_timer.h>
+#include "freertos/semphr.h"
+#include "ssd1306.h"
+#include "ssd1306_const.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Grayscale by frame-rate control. Bit 0 of a pixel's level lives in plane 0 and bit 1 in plane 1. Subframe 0
+ * lights levels 1 to 3 ('plane0 | plane1'), subframe 1 levels 2 and 3 ('plane1') and subframe 2 level 3 only
+ * ('plane0 & plane1'), so a pixel of level L is lit in L of the SSD1306_GRAY_SUBFRAMES subframes.
+ */
+
+struct ssd1306_gray
+{
+    esp_timer_handle_t timer;
+    TaskHandle_t task;
+    SemaphoreHandle_t lock;  // Guards 'front' and 'stats'
+    SemaphoreHandle_t idle;  // Given while no subframe is in flight
+    uint8_t *storage;
+    uint8_t *back[2];        // Bitplanes drawn into
+    uint8_t *front[2];       // Bitplanes the subframes are composed from
+    uint8_t *output;         // Pixels of the subframe, behind a framebuffer header
+    size_t plane_size;       // Bytes of a bitplane, rounded up to whole words
+    uint8_t subframe;
+    ssd1306_gray_stats_t stats;
+    int64_t first_start_us;  // Start of the first measured subframe
+    int64_t last_start_us;
+};
+
+static void ssd1306_gray_compose(ssd1306_gray_t *gray)
+{
+    const ssd1306_word_t *plane0 = (const ssd1306_word_t *)gray->front[0];
+    const ssd1306_word_t *plane1 = (const ssd1306_word_t *)gray->front[1];
+    ssd1306_word_t *output = (ssd1306_word_t *)gray->output;
+    size_t words = gray->plane_size / sizeof(ssd1306_word_t);
+
+    switch (gray->subframe)
+    {
+    case 0:
+        for (size_t i = 0; i < words; i++)
+            output[i] = plane0[i] | plane1[i];
+        break;
+    case 1:
+        for (size_t i = 0; i < words; i++)
+            output[i] = plane1[i];
+        break;
+    default:
+        for (size_t i = 0; i < words; i++)
+            output[i] = plane0[i] & plane1[i];
+        break;
+    }
+}
+
+/* Account a subframe that started at 'start_us' and the 'missed_ticks' that were dropped while the previous one was sent. */
+static void ssd1306_gray_measure(ssd1306_gray_t *gray, int64_t start_us, esp_err_t err, uint32_t missed_ticks)
+{
+    ssd1306_gray_stats_t *stats = &gray->stats;
+    if (stats->subframes == 0)
+    {
+        gray->first_start_us = start_us;
+    }
+    else
+    {
+        uint32_t period_us = (uint32_t)(start_us - gray->last_start_us);
+        if (period_us > stats->worst_subframe_period_us)
+            stats->worst_subframe_period_us = period_us;
+        stats->subframe_period_us = (uint32_t)((start_us - gray->first_start_us) / stats->subframes);
+        stats->refresh_hz = stats->subframe_period_us ? 1000000 / (stats->subframe_period_us * SSD1306_GRAY_SUBFRAMES) : 0;
+    }
+    gray->last_start_us = start_us;
+    stats->subframes++;
+    stats->missed_ticks += missed_ticks;
+    if (err != ESP_OK)
+        stats->failed_subframes++;
+}
+
+static esp_err_t ssd1306_gray_send(i2c_ssd1306_handle_t *i2c_ssd1306, uint32_t missed_ticks)
+{
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    xSemaphoreTake(gray->lock, portMAX_DELAY);
+    ssd1306_gray_compose(gray);
+    xSemaphoreGive(gray->lock);
+
+    int64_t start = esp_timer_get_time();
+    i2c_ssd1306->flush_wire_bytes = 0;
+    esp_err_t err = ssd1306_window_to_ram(i2c_ssd1306, gray->output, 0, i2c_ssd1306->total_pages - 1, 0, i2c_ssd1306->width - 1);
+    ssd1306_stats_frame(i2c_ssd1306, start, err);
+
+    xSemaphoreTake(gray->lock, portMAX_DELAY);
+    ssd1306_gray_measure(gray, start, err, missed_ticks);
+    xSemaphoreGive(gray->lock);
+    gray->subframe = (gray->subframe + 1) % SSD1306_GRAY_SUBFRAMES;
+
+    return err;
+}
+
+static void ssd1306_gray_tick(void *arg)
+{
+    xTaskNotifyGive(((ssd1306_gray_t *)arg)->task);
+}
+
+static void ssd1306_gray_task(void *arg)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = (i2c_ssd1306_handle_t *)arg;
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+
+    while (1)
+    {
+        /* Ticks that piled up while the last subframe was on the bus are dropped rather than sent back to back. */
+        uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        xSemaphoreTake(gray->idle, portMAX_DELAY);
+        if (ssd1306_gray_send(i2c_ssd1306, ticks - 1) != ESP_OK)
+            ESP_LOGE(SSD1306_TAG, "Failed to send a grayscale subframe to the SSD1306 device");
+        xSemaphoreGive(gray->idle);
+    }
+}
+
+static void ssd1306_gray_free(ssd1306_gray_t *gray)
+{
+    if (gray->lock)
+        vSemaphoreDelete(gray->lock);
+    if (gray->idle)
+        vSemaphoreDelete(gray->idle);
+    free(gray->storage);
+    free(gray);
+}
+
+uint32_t i2c_ssd1306_gray_max_subframe_hz(const i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    /* Wire bytes and transactions of ssd1306_window_to_ram() for the whole panel; a data run adds its control byte. */
+    uint32_t bytes, transactions;
+    if (i2c_ssd1306->addressing == SSD1306_ADDRESSING_HORIZONTAL)
+    {
+        bytes = (1 + 7) + (1 + 1 + (uint32_t)i2c_ssd1306->width * i2c_ssd1306->total_pages);
+        transactions = 2;
+    }
+    else
+    {
+        bytes = (uint32_t)i2c_ssd1306->total_pages * ((1 + 4) + (1 + 1 + i2c_ssd1306->width));
+        transactions = 2 * i2c_ssd1306->total_pages;
+    }
+
+    return i2c_ssd1306->i2c_scl_speed_hz / (bytes * 9 + transactions * 2);
+}
+
+esp_err_t i2c_ssd1306_gray_start(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_gray_config_t *gray_config)
+{
+    if (i2c_ssd1306->async != NULL || i2c_ssd1306->scheduler != NULL || i2c_ssd1306->gray != NULL || i2c_ssd1306->console != NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 flush task, a scheduler, a console or the grayscale mode already owns the display");
+        return ESP_ERR_INVALID_STATE;
+    }
+    uint32_t max_subframe_hz = i2c_ssd1306_gray_max_subframe_hz(i2c_ssd1306);
+    if (gray_config->subframe_hz > max_subframe_hz)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid grayscale configuration, 'subframe_hz' must be at most %lu at %lu Hz SCL", (unsigned long)max_subframe_hz, (unsigned long)i2c_ssd1306->i2c_scl_speed_hz);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_gray_t *gray = (ssd1306_gray_t *)calloc(1, sizeof(ssd1306_gray_t));
+    if (gray == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 grayscale mode");
+        return ESP_ERR_NO_MEM;
+    }
+    /* Four bitplanes and the subframe, each a whole number of words so they are composed word by word. */
+    gray->plane_size = ((size_t)i2c_ssd1306->width * i2c_ssd1306->total_pages + 3) & ~(size_t)3;
+    gray->storage = (uint8_t *)calloc(1, 5 * gray->plane_size + SSD1306_FRAMEBUFFER_HEADER);
+    gray->lock = xSemaphoreCreateMutex();
+    gray->idle = xSemaphoreCreateBinary();
+    if (gray->storage == NULL || gray->lock == NULL || gray->idle == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 gray bitplanes");
+        ssd1306_gray_free(gray);
+        return ESP_ERR_NO_MEM;
+    }
+    for (int plane = 0; plane < 2; plane++)
+    {
+        gray->back[plane] = gray->storage + plane * gray->plane_size;
+        gray->front[plane] = gray->storage + (2 + plane) * gray->plane_size;
+    }
+    gray->output = gray->storage + 4 * gray->plane_size + SSD1306_FRAMEBUFFER_HEADER;
+    gray->output[-1] = OLED_CONTROL_BYTE_DATA;
+    xSemaphoreGive(gray->idle);
+
+    i2c_ssd1306->gray = gray;
+    if (gray_config->subframe_hz == 0)
+        return ESP_OK;
+
+    if (xTaskCreatePinnedToCore(ssd1306_gray_task, "ssd1306_gray", gray_config->task_stack_size, i2c_ssd1306,
+                                gray_config->task_priority, &gray->task, gray_config->task_core_id) != pdPASS)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to create the SSD1306 grayscale flush task");
+        i2c_ssd1306->gray = NULL;
+        ssd1306_gray_free(gray);
+        return ESP_ERR_NO_MEM;
+    }
+    const esp_timer_create_args_t timer_args = {
+        .callback = ssd1306_gray_tick,
+        .arg = gray,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "ssd1306_gray",
+        .skip_unhandled_events = true};
+    esp_err_t err = esp_timer_create(&timer_args, &gray->timer);
+    if (err == ESP_OK)
+        err = esp_timer_start_periodic(gray->timer, 1000000 / gray_config->subframe_hz);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to start the SSD1306 grayscale subframe timer: %s", esp_err_to_name(err));
+        if (gray->timer)
+            esp_timer_delete(gray->timer);
+        vTaskDelete(gray->task);
+        i2c_ssd1306->gray = NULL;
+        ssd1306_gray_free(gray);
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_gray_stop(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    if (gray == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 grayscale mode is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (gray->timer)
+    {
+        esp_timer_stop(gray->timer);
+        esp_timer_delete(gray->timer);
+    }
+    if (gray->task)
+    {
+        /* The task only blocks on its notification or on 'idle' between subframes, so it holds nothing when deleted. */
+        xSemaphoreTake(gray->idle, portMAX_DELAY);
+        vTaskDelete(gray->task);
+    }
+    i2c_ssd1306->gray = NULL;
+    ssd1306_gray_free(gray);
+    /* The display RAM holds the last subframe, not the 1bpp framebuffer. */
+    ssd1306_mark_all_dirty(i2c_ssd1306);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_gray_step(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    if (gray == NULL || gray->timer != NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 grayscale mode is not running or paces its own subframes");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return ssd1306_gray_send(i2c_ssd1306, 0);
+}
+
+esp_err_t i2c_ssd1306_gray_present(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    if (gray == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 grayscale mode is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(gray->lock, portMAX_DELAY);
+    memcpy(gray->front[0], gray->back[0], 2 * gray->plane_size);
+    xSemaphoreGive(gray->lock);
+
+    return ESP_OK;
+}
+
+/* Common checks of the drawing functions. */
+static esp_err_t ssd1306_gray_check(const i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t level)
+{
+    if (i2c_ssd1306->gray == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 grayscale mode is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (level >= SSD1306_GRAY_LEVELS)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid gray level, 'level' must be between 0 and %d", SSD1306_GRAY_LEVELS - 1);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return ESP_OK;
+}
+
+/* Set the bits of 'mask' in 'columns' bytes of both back planes from offset 'at' to 'level'. */
+static void ssd1306_gray_write(ssd1306_gray_t *gray, size_t at, uint16_t columns, uint8_t mask, uint8_t level)
+{
+    for (int plane = 0; plane < 2; plane++)
+    {
+        uint8_t *bytes = &gray->back[plane][at];
+        if (level & (1 << plane))
+        {
+            for (uint16_t j = 0; j < columns; j++)
+                bytes[j] |= mask;
+        }
+        else
+        {
+            for (uint16_t j = 0; j < columns; j++)
+                bytes[j] &= ~mask;
+        }
+    }
+}
+
+esp_err_t i2c_ssd1306_gray_clear(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t level)
+{
+    esp_err_t ret = ssd1306_gray_check(i2c_ssd1306, level);
+    if (ret != ESP_OK)
+        return ret;
+
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    memset(gray->back[0], (level & 1) ? 0xFF : 0x00, gray->plane_size);
+    memset(gray->back[1], (level & 2) ? 0xFF : 0x00, gray->plane_size);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_gray_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, uint8_t level)
+{
+    esp_err_t ret = ssd1306_gray_check(i2c_ssd1306, level);
+    if (ret != ESP_OK)
+        return ret;
+    if (x >= i2c_ssd1306->width || y >= i2c_ssd1306->height)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid coordinates, 'x' must be between 0 and %d, 'y' must be between 0 and %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_gray_write(i2c_ssd1306->gray, (y / 8) * i2c_ssd1306->width + x, 1, 1 << (y % 8), level);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_gray_fill_rect(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t level)
+{
+    esp_err_t ret = ssd1306_gray_check(i2c_ssd1306, level);
+    if (ret != ESP_OK)
+        return ret;
+
+    int32_t x1 = (x < 0) ? 0 : x;
+    int32_t y1 = (y < 0) ? 0 : y;
+    int32_t x2 = (x + w < i2c_ssd1306->width) ? x + w - 1 : i2c_ssd1306->width - 1;
+    int32_t y2 = (y + h < i2c_ssd1306->height) ? y + h - 1 : i2c_ssd1306->height - 1;
+    if (x1 > x2 || y1 > y2)
+        return ESP_OK;
+
+    for (int32_t page = y1 / 8; page <= y2 / 8; page++)
+    {
+        uint8_t mask = 0xFF;
+        if (page == y1 / 8)
+            mask &= 0xFF << (y1 % 8);
+        if (page == y2 / 8)
+            mask &= 0xFF >> (7 - y2 % 8);
+        ssd1306_gray_write(i2c_ssd1306->gray, page * i2c_ssd1306->width + x1, x2 - x1 + 1, mask, level);
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_gray_import(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t level)
+{
+    esp_err_t ret = ssd1306_gray_check(i2c_ssd1306, level);
+    if (ret != ESP_OK)
+        return ret;
+
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    const uint8_t *lit = i2c_ssd1306->framebuffer;
+    size_t size = (size_t)i2c_ssd1306->width * i2c_ssd1306->total_pages;
+    for (int plane = 0; plane < 2; plane++)
+    {
+        uint8_t *bytes = gray->back[plane];
+        if (level & (1 << plane))
+        {
+            for (size_t i = 0; i < size; i++)
+                bytes[i] |= lit[i];
+        }
+        else
+        {
+            for (size_t i = 0; i < size; i++)
+                bytes[i] &= ~lit[i];
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_gray_get_stats(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_gray_stats_t *stats)
+{
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    if (gray == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 grayscale mode is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(gray->lock, portMAX_DELAY);
+    *stats = gray->stats;
+    xSemaphoreGive(gray->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_gray_reset_stats(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_gray_t *gray = i2c_ssd1306->gray;
+    if (gray == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 grayscale mode is not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(gray->lock, portMAX_DELAY);
+    memset(&gray->stats, 0, sizeof(gray->stats));
+    xSemaphoreGive(gray->lock);
+
+    return ESP_OK;
+}
@@ -0,0 +1,194 @@
+#include "ssd1306.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Image assets. The decoder walks the packets of an asset and hands every run of literal or repeated bytes to the
+ * writer, which places them straight into the framebuffer pages they land on, so no decoded copy of the image is
+ * ever held in RAM. Decoding stops at the first strip below the panel.
+ */
+
+/* Clip window of an image on the panel and the strip and column of the next decoded byte. */
+typedef struct
+{
+    uint8_t *framebuffer;
+    int16_t x;
+    int32_t first_page;
+    uint8_t shift;
+    uint16_t first_column;
+    uint16_t end_column;
+    uint8_t image_width;
+    uint8_t image_pages;
+    uint8_t last_row_mask;
+    uint8_t invert_mask;
+    uint16_t strip;
+    uint16_t column;
+} ssd1306_image_writer_t;
+
+/*
+ * Copy 'columns' bytes, taken from 'src' or all equal to 'value', limited to 'area', over the page row 'lower' and
+ * the row 'upper' below it after shifting them down by 'shift' rows. Either row is NULL when it lies outside of the
+ * panel.
+ */
+SSD1306_ALWAYS_INLINE void ssd1306_image_run(uint8_t *lower, uint8_t *upper, const uint8_t *src, uint8_t value, uint8_t invert_mask, uint8_t area, uint16_t columns, uint8_t shift)
+{
+    uint16_t shifted_area = (uint16_t)area << shift;
+    for (uint16_t j = 0; j < columns; j++)
+    {
+        uint16_t bits = (uint16_t)(((src ? src[j] : value) ^ invert_mask) & area) << shift;
+        if (lower)
+            lower[j] = (lower[j] & ~(uint8_t)shifted_area) | (uint8_t)bits;
+        if (upper)
+            upper[j] = (upper[j] & ~(uint8_t)(shifted_area >> 8)) | (uint8_t)(bits >> 8);
+    }
+}
+
+/* One copy of the run per destination rows present and per source kind, so the inner loop tests none of them. */
+SSD1306_ALWAYS_INLINE void ssd1306_image_strip(uint8_t *lower, uint8_t *upper, const uint8_t *src, uint8_t value, uint8_t invert_mask, uint8_t area, uint16_t columns, uint8_t shift)
+{
+    if (src)
+    {
+        if (lower && upper)
+            ssd1306_image_run(lower, upper, src, 0, invert_mask, area, columns, shift);
+        else if (lower)
+            ssd1306_image_run(lower, NULL, src, 0, invert_mask, area, columns, shift);
+        else
+            ssd1306_image_run(NULL, upper, src, 0, invert_mask, area, columns, shift);
+    }
+    else
+    {
+        if (lower && upper)
+            ssd1306_image_run(lower, upper, NULL, value, invert_mask, area, columns, shift);
+        else if (lower)
+            ssd1306_image_run(lower, NULL, NULL, value, invert_mask, area, columns, shift);
+        else
+            ssd1306_image_run(NULL, upper, NULL, value, invert_mask, area, columns, shift);
+    }
+}
+
+/* Whether the next decoded byte still lies in the image and not below the panel. */
+SSD1306_ALWAYS_INLINE bool ssd1306_image_pending(const ssd1306_image_writer_t *writer, uint8_t height)
+{
+    return writer->strip < writer->image_pages && writer->first_page + writer->strip < height / 8;
+}
+
+/*
+ * Write the next 'count' decoded bytes, the 'literal' ones or, when NULL, 'count' copies of 'value'.
+ * Returns false once the rest of the image lies below the panel or past its last strip.
+ */
+SSD1306_ALWAYS_INLINE bool ssd1306_image_write(ssd1306_image_writer_t *writer, uint8_t width, uint8_t height, const uint8_t *literal, uint8_t value, uint16_t count)
+{
+    uint8_t num_pages = height / 8;
+    while (count > 0)
+    {
+        if (!ssd1306_image_pending(writer, height))
+            return false;
+        int32_t target_page = writer->first_page + writer->strip;
+
+        uint16_t chunk = writer->image_width - writer->column;
+        chunk = (chunk < count) ? chunk : count;
+        uint16_t begin = (writer->column > writer->first_column) ? writer->column : writer->first_column;
+        uint16_t end = (writer->column + chunk < writer->end_column) ? writer->column + chunk : writer->end_column;
+        if (begin < end)
+        {
+            uint8_t *lower = (target_page >= 0) ? &writer->framebuffer[target_page * width + writer->x + begin] : NULL;
+            uint8_t *upper = (writer->shift != 0 && target_page + 1 >= 0 && target_page + 1 < num_pages) ? &writer->framebuffer[(target_page + 1) * width + writer->x + begin] : NULL;
+            uint8_t area = (writer->strip == writer->image_pages - 1) ? writer->last_row_mask : 0xFF;
+            if (lower || upper)
+                ssd1306_image_strip(lower, upper, literal ? literal + (begin - writer->column) : NULL, value, writer->invert_mask, area, end - begin, writer->shift);
+        }
+
+        count -= chunk;
+        if (literal)
+            literal += chunk;
+        writer->column += chunk;
+        if (writer->column == writer->image_width)
+        {
+            writer->column = 0;
+            writer->strip++;
+        }
+    }
+
+    return true;
+}
+
+/* Feed the bytes of 'image' to the writer; ESP_ERR_INVALID_SIZE if they run out while the writer still wants more. */
+SSD1306_ALWAYS_INLINE esp_err_t ssd1306_image_decode(ssd1306_image_writer_t *writer, uint8_t width, uint8_t height, const ssd1306_image_t *image)
+{
+    const uint8_t *in = image->data;
+    const uint8_t *in_end = image->data + image->size;
+
+    if (image->encoding == SSD1306_IMAGE_RAW)
+    {
+        uint32_t image_size = (uint32_t)image->width * writer->image_pages;
+        ssd1306_image_write(writer, width, height, in, 0, (image->size < image_size) ? image->size : image_size);
+        return ssd1306_image_pending(writer, height) ? ESP_ERR_INVALID_SIZE : ESP_OK;
+    }
+
+    while (in < in_end)
+    {
+        uint8_t control = *in++;
+        if (control < 0x80)
+        {
+            uint16_t count = control + 1;
+            if (count > in_end - in)
+                return ESP_ERR_INVALID_SIZE;
+            if (!ssd1306_image_write(writer, width, height, in, 0, count))
+                return ESP_OK;
+            in += count;
+        }
+        else
+        {
+            if (in == in_end)
+                return ESP_ERR_INVALID_SIZE;
+            if (!ssd1306_image_write(writer, width, height, NULL, *in++, control - 0x80 + 3))
+                return ESP_OK;
+        }
+    }
+
+    return ssd1306_image_pending(writer, height) ? ESP_ERR_INVALID_SIZE : ESP_OK;
+}
+
+SSD1306_ALWAYS_INLINE esp_err_t ssd1306_image_asset(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, int16_t x, int16_t y, const ssd1306_image_t *image, bool invert)
+{
+    if (image == NULL || image->data == NULL || image->size == 0 || image->width == 0 || image->height == 0 ||
+        image->encoding > SSD1306_IMAGE_RLE)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid image asset, it must have data, a non-zero size and a known encoding");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int32_t first_column = (x < 0) ? -x : 0;
+    int32_t end_column = (x + image->width < width) ? image->width : width - x;
+    if (first_column >= end_column || y + image->height <= 0 || y >= height)
+        return ESP_OK;
+
+    /* Page row of the image's top row, rounded down for a negative 'y', and the sub-byte shift shared by every strip. */
+    int32_t first_page = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    ssd1306_image_writer_t writer = {
+        .framebuffer = i2c_ssd1306->framebuffer,
+        .x = x,
+        .first_page = first_page,
+        .shift = y - first_page * 8,
+        .first_column = first_column,
+        .end_column = end_column,
+        .image_width = image->width,
+        .image_pages = (image->height + 7) / 8,
+        .last_row_mask = (image->height % 8) ? 0xFF >> (8 - image->height % 8) : 0xFF,
+        .invert_mask = invert ? 0xFF : 0x00,
+        .strip = 0,
+        .column = 0};
+    esp_err_t err = ssd1306_image_decode(&writer, width, height, image);
+
+    int32_t top = (y < 0) ? 0 : y;
+    int32_t bottom = (y + image->height < height) ? y + image->height - 1 : height - 1;
+    ssd1306_mark_dirty(i2c_ssd1306, top / 8, bottom / 8, x + first_column, x + end_column - 1);
+    if (err != ESP_OK)
+        ESP_LOGE(SSD1306_TAG, "Image asset data ends before strip %d, column %d", writer.strip, writer.column);
+
+    return err;
+}
+
+esp_err_t i2c_ssd1306_buffer_image_asset(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, const ssd1306_image_t *image, bool invert)
+{
+    return SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_image_asset, x, y, image, invert);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Image assets, generated by tools/ssd1306_imagegen.py from PNG files.
+ *
+ * The pixels are (height + 7) / 8 page-major strips of 'width' column bytes (LSB at the top), the layout of a
+ * framebuffer page, stored either as they are or run-length encoded. Assets are const, so they stay in flash, and
+ * i2c_ssd1306_buffer_image_asset() decodes them straight into the framebuffer. Assets that are not referenced are
+ * dropped by the linker.
+ */
+
+/**
+ * @brief Storage of the bytes of an image asset.
+ *
+ * SSD1306_IMAGE_RLE is a sequence of packets. A control byte below 0x80 is followed by 'control + 1' literal bytes;
+ * a control byte of 0x80 or more is followed by one byte that repeats 'control - 0x80 + 3' times. Packets run on
+ * across strips.
+ */
+typedef enum
+{
+    SSD1306_IMAGE_RAW,
+    SSD1306_IMAGE_RLE,
+} ssd1306_image_encoding_t;
+
+/**
+ * @brief Image asset.
+ *
+ * 'data' holds 'size' bytes in 'encoding' that decode to (height + 7) / 8 strips of 'width' bytes.
+ */
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    uint8_t encoding;
+    uint16_t size;
+    const uint8_t *data;
+} ssd1306_image_t;
+
+/* 64x64 boot logo of init_ssd1306(); a 128x32 panel shows its top half. */
+extern const ssd1306_image_t ssd1306_logo;
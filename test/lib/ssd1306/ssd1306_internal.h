@@ -0,0 +1,99 @@
+#pragma once
+
+/* Driver internals shared between the SSD1306 translation units. Not part of the public API. */
+
+#include "freertos/semphr.h"
+#include "ssd1306.h"
+
+#define SSD1306_ALWAYS_INLINE static inline __attribute__((always_inline))
+
+/* 32-bit view of framebuffer and font bytes; all word accesses are 4-byte aligned. */
+typedef uint32_t __attribute__((may_alias)) ssd1306_word_t;
+
+/* A byte replicated into the four lanes of a word. */
+#define SSD1306_LANES(byte) ((uint32_t)(uint8_t)(byte) * 0x01010101u)
+
+#ifdef SSD1306_FIXED_WIDTH
+static inline bool ssd1306_is_fixed(const i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    return i2c_ssd1306->width == SSD1306_FIXED_WIDTH && i2c_ssd1306->height == SSD1306_FIXED_HEIGHT;
+}
+
+/*
+ * Call 'body', an SSD1306_ALWAYS_INLINE function taking the handle, width and height first, with the geometry
+ * as constants when the handle matches the compile-time geometry, so that the inlined copy folds it.
+ */
+#define SSD1306_SPECIALIZE(i2c_ssd1306, body, ...)                                                       \
+    (ssd1306_is_fixed(i2c_ssd1306) ? body(i2c_ssd1306, SSD1306_FIXED_WIDTH, SSD1306_FIXED_HEIGHT, ##__VA_ARGS__) \
+                                   : body(i2c_ssd1306, (i2c_ssd1306)->width, (i2c_ssd1306)->height, ##__VA_ARGS__))
+#else
+#define SSD1306_SPECIALIZE(i2c_ssd1306, body, ...) body(i2c_ssd1306, (i2c_ssd1306)->width, (i2c_ssd1306)->height, ##__VA_ARGS__)
+#endif
+
+/* Segments of one page inside the page-major framebuffer. */
+static inline uint8_t *ssd1306_page(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page)
+{
+    return &i2c_ssd1306->framebuffer[page * i2c_ssd1306->width];
+}
+
+/* Grow the dirty window of pages 'initial_page'..'final_page' to cover segments 'initial_segment'..'final_segment'. */
+void ssd1306_dirty_add(ssd1306_dirty_t *dirty, uint8_t initial_page, uint8_t final_page, uint8_t initial_segment, uint8_t final_segment);
+
+/* Copy the dirty windows of the handle's framebuffer into 'front', merge them into 'window' and clear the handle's dirty state. */
+void ssd1306_dirty_copy(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *front, ssd1306_dirty_t *window);
+
+static inline void ssd1306_mark_dirty(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t initial_page, uint8_t final_page, uint8_t initial_segment, uint8_t final_segment)
+{
+    ssd1306_dirty_add(&i2c_ssd1306->dirty, initial_page, final_page, initial_segment, final_segment);
+}
+
+static inline void ssd1306_mark_all_dirty(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_dirty_add(&i2c_ssd1306->dirty, 0, i2c_ssd1306->total_pages - 1, 0, i2c_ssd1306->width - 1);
+}
+
+/* Set or clear the rectangle 'x1'..'x2' x 'y1'..'y2' (inclusive, inside the panel) with one byte mask per page. Does not mark it dirty. */
+void ssd1306_fill_rect(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill);
+
+/* i2c_ssd1306_buffer_text_font() and i2c_ssd1306_buffer_sprite() without argument checks, for validated display lists. */
+void ssd1306_draw_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop);
+void ssd1306_draw_sprite(i2c_ssd1306_handle_t *i2c_ssd1306, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop);
+
+/* i2c_ssd1306_buffer_line() and the outlined or filled ('filled') circle without their entry points; clip and mark dirty. */
+void ssd1306_draw_line(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t x1, int32_t y1, int32_t x2, int32_t y2, bool fill);
+void ssd1306_draw_circle(i2c_ssd1306_handle_t *i2c_ssd1306, int32_t cx, int32_t cy, int32_t r, bool filled, bool fill);
+
+/* Decode the UTF-8 sequence at '*text' and move '*text' past it. Malformed sequences decode to U+FFFD. */
+uint32_t ssd1306_utf8_next(const char **text);
+
+/* Single I2C write that accounts the address byte and payload in 'flush_wire_bytes' and the telemetry. */
+esp_err_t ssd1306_transmit(i2c_ssd1306_handle_t *i2c_ssd1306, const uint8_t *data, size_t size);
+
+/* Account one I2C transaction of 'wire_bytes' bytes that returned 'err' after 'elapsed_us' in the telemetry. */
+void ssd1306_stats_transaction(i2c_ssd1306_handle_t *i2c_ssd1306, size_t wire_bytes, esp_err_t err, int64_t elapsed_us);
+
+/* Account a flush that started at 'start_us' (esp_timer_get_time()) as a frame, if it put anything on the bus. */
+void ssd1306_stats_frame(i2c_ssd1306_handle_t *i2c_ssd1306, int64_t start_us, esp_err_t err);
+
+/*
+ * Send the rectangle 'initial_page'..'final_page' x 'initial_segment'..'final_segment' of 'framebuffer'
+ * (pixels laid out like the handle's framebuffer, header included) to the display RAM.
+ * Fails with ESP_ERR_INVALID_STATE while a continuous scroll runs.
+ */
+esp_err_t ssd1306_window_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *framebuffer, uint8_t initial_page, uint8_t final_page, uint8_t initial_segment, uint8_t final_segment);
+
+/* Send the windows described by 'dirty' from 'framebuffer' and clear every page of 'dirty' that was sent. */
+esp_err_t ssd1306_dirty_window_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *framebuffer, ssd1306_dirty_t *dirty);
+
+/* i2c_ssd1306_present() for a display added to a scheduler. */
+esp_err_t ssd1306_scheduler_present(i2c_ssd1306_handle_t *i2c_ssd1306);
+
+/*
+ * Front buffer pixels and not yet sent windows of a display served by the flush task or a scheduler, with
+ * '*lock' taken to keep the task off them; give '*lock' back when done. Returns NULL, without locking, for a
+ * synchronous display.
+ */
+uint8_t *ssd1306_front_acquire(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_dirty_t **pending, SemaphoreHandle_t *lock);
+
+/* ssd1306_front_acquire() for a display added to a scheduler; '*lock' is the slot lock. */
+uint8_t *ssd1306_scheduler_front_acquire(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_dirty_t **pending, SemaphoreHandle_t *lock);
@@ -0,0 +1,257 @@
+#include "ssd1306.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Display lists. Recording appends a fixed-size command and nothing else. Submit validates the list once (until
+ * it is recorded again) and then runs a single interpreter loop, specialized for the panel geometry, that clips
+ * every command to the panel and draws it through the unchecked bodies of the buffer functions: rectangles and
+ * pixels inline against the constant geometry, lines, circles, text and sprites through their internal bodies.
+ */
+
+static esp_err_t ssd1306_list_append(ssd1306_list_t *list, ssd1306_list_op_t op, bool fill, int16_t x1, int16_t y1, int16_t x2, int16_t y2, ssd1306_list_command_t **command)
+{
+    if (list->count >= list->capacity)
+    {
+        list->overflow = true;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ssd1306_list_command_t *next = &list->commands[list->count++];
+    next->op = op;
+    next->fill = fill;
+    next->rop = SSD1306_ROP_OR;
+    next->x1 = x1;
+    next->y1 = y1;
+    next->x2 = x2;
+    next->y2 = y2;
+    list->validated = false;
+    if (command)
+        *command = next;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_list_init(ssd1306_list_t *list, ssd1306_list_command_t *commands, uint16_t capacity)
+{
+    if (!list || !commands || capacity == 0)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid display list storage");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    list->commands = commands;
+    list->capacity = capacity;
+    i2c_ssd1306_list_reset(list);
+
+    return ESP_OK;
+}
+
+void i2c_ssd1306_list_reset(ssd1306_list_t *list)
+{
+    list->count = 0;
+    list->overflow = false;
+    list->validated = false;
+}
+
+esp_err_t i2c_ssd1306_list_clear(ssd1306_list_t *list, bool fill)
+{
+    return ssd1306_list_append(list, SSD1306_LIST_CLEAR, fill, 0, 0, 0, 0, NULL);
+}
+
+esp_err_t i2c_ssd1306_list_pixel(ssd1306_list_t *list, int16_t x, int16_t y, bool fill)
+{
+    return ssd1306_list_append(list, SSD1306_LIST_PIXEL, fill, x, y, 0, 0, NULL);
+}
+
+esp_err_t i2c_ssd1306_list_fill_rect(ssd1306_list_t *list, int16_t x, int16_t y, uint8_t w, uint8_t h, bool fill)
+{
+    return ssd1306_list_append(list, SSD1306_LIST_FILL_RECT, fill, x, y, w, h, NULL);
+}
+
+esp_err_t i2c_ssd1306_list_rect(ssd1306_list_t *list, int16_t x, int16_t y, uint8_t w, uint8_t h, bool fill)
+{
+    return ssd1306_list_append(list, SSD1306_LIST_RECT, fill, x, y, w, h, NULL);
+}
+
+esp_err_t i2c_ssd1306_list_line(ssd1306_list_t *list, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool fill)
+{
+    return ssd1306_list_append(list, SSD1306_LIST_LINE, fill, x1, y1, x2, y2, NULL);
+}
+
+esp_err_t i2c_ssd1306_list_circle(ssd1306_list_t *list, int16_t cx, int16_t cy, uint8_t r, bool fill)
+{
+    return ssd1306_list_append(list, SSD1306_LIST_CIRCLE, fill, cx, cy, r, 0, NULL);
+}
+
+esp_err_t i2c_ssd1306_list_fill_circle(ssd1306_list_t *list, int16_t cx, int16_t cy, uint8_t r, bool fill)
+{
+    return ssd1306_list_append(list, SSD1306_LIST_FILL_CIRCLE, fill, cx, cy, r, 0, NULL);
+}
+
+esp_err_t i2c_ssd1306_list_text(ssd1306_list_t *list, uint8_t x, uint8_t y, const char *text, const ssd1306_font_t *font, bool invert, ssd1306_rop_t rop)
+{
+    ssd1306_list_command_t *command;
+    esp_err_t ret = ssd1306_list_append(list, SSD1306_LIST_TEXT, invert, x, y, 0, 0, &command);
+    if (ret != ESP_OK)
+        return ret;
+
+    command->rop = rop;
+    command->data.text.text = text;
+    command->data.text.font = font;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_list_sprite(ssd1306_list_t *list, int16_t x, int16_t y, const ssd1306_sprite_t *sprite, ssd1306_rop_t rop)
+{
+    ssd1306_list_command_t *command;
+    esp_err_t ret = ssd1306_list_append(list, SSD1306_LIST_SPRITE, false, x, y, 0, 0, &command);
+    if (ret != ESP_OK)
+        return ret;
+
+    command->rop = rop;
+    command->data.sprite = sprite;
+
+    return ESP_OK;
+}
+
+static bool ssd1306_list_command_valid(const ssd1306_list_command_t *command)
+{
+    switch (command->op)
+    {
+    case SSD1306_LIST_CLEAR:
+    case SSD1306_LIST_PIXEL:
+    case SSD1306_LIST_FILL_RECT:
+    case SSD1306_LIST_RECT:
+    case SSD1306_LIST_LINE:
+    case SSD1306_LIST_CIRCLE:
+    case SSD1306_LIST_FILL_CIRCLE:
+        return true;
+    case SSD1306_LIST_TEXT:
+        return command->data.text.text && command->data.text.text[0] != '\0' && command->data.text.font &&
+               (command->rop == SSD1306_ROP_OR || command->rop == SSD1306_ROP_COPY);
+    case SSD1306_LIST_SPRITE:
+    {
+        const ssd1306_sprite_t *sprite = command->data.sprite;
+        return sprite && sprite->bitmap && sprite->width && sprite->height && command->rop <= SSD1306_ROP_XOR;
+    }
+    default:
+        return false;
+    }
+}
+
+static esp_err_t ssd1306_list_validate(ssd1306_list_t *list)
+{
+    if (list->overflow)
+    {
+        ESP_LOGE(SSD1306_TAG, "Display list overflowed its %d commands", list->capacity);
+        return ESP_ERR_NO_MEM;
+    }
+    for (uint16_t i = 0; i < list->count; i++)
+    {
+        if (!ssd1306_list_command_valid(&list->commands[i]))
+        {
+            ESP_LOGE(SSD1306_TAG, "Invalid display list command %d (operation %d)", i, list->commands[i].op);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    list->validated = true;
+
+    return ESP_OK;
+}
+
+/* Clip x1..x2 x y1..y2 (inclusive, possibly off the panel) and fill it; returns whether anything was left. */
+SSD1306_ALWAYS_INLINE bool ssd1306_list_fill(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, int32_t x1, int32_t x2, int32_t y1, int32_t y2, bool fill)
+{
+    x1 = (x1 < 0) ? 0 : x1;
+    y1 = (y1 < 0) ? 0 : y1;
+    x2 = (x2 < width) ? x2 : width - 1;
+    y2 = (y2 < height) ? y2 : height - 1;
+    if (x1 > x2 || y1 > y2)
+        return false;
+    ssd1306_fill_rect(i2c_ssd1306, x1, x2, y1, y2, fill);
+
+    return true;
+}
+
+/* Mark the part of x1..x2 x y1..y2 that is on the panel dirty. */
+SSD1306_ALWAYS_INLINE void ssd1306_list_mark(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, int32_t x1, int32_t x2, int32_t y1, int32_t y2)
+{
+    x1 = (x1 < 0) ? 0 : x1;
+    y1 = (y1 < 0) ? 0 : y1;
+    x2 = (x2 < width) ? x2 : width - 1;
+    y2 = (y2 < height) ? y2 : height - 1;
+    if (x1 <= x2 && y1 <= y2)
+        ssd1306_mark_dirty(i2c_ssd1306, y1 / 8, y2 / 8, x1, x2);
+}
+
+SSD1306_ALWAYS_INLINE void ssd1306_list_run(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height, const ssd1306_list_t *list)
+{
+    for (uint16_t i = 0; i < list->count; i++)
+    {
+        const ssd1306_list_command_t *command = &list->commands[i];
+        switch (command->op)
+        {
+        case SSD1306_LIST_CLEAR:
+            memset(i2c_ssd1306->framebuffer, command->fill ? 0xFF : 0x00, width * (height / 8));
+            ssd1306_mark_dirty(i2c_ssd1306, 0, height / 8 - 1, 0, width - 1);
+            break;
+        case SSD1306_LIST_PIXEL:
+            if (command->x1 >= 0 && command->x1 < width && command->y1 >= 0 && command->y1 < height)
+            {
+                uint8_t *segment = &i2c_ssd1306->framebuffer[(command->y1 / 8) * width + command->x1];
+                uint8_t bit = 1 << (command->y1 % 8);
+                *segment = command->fill ? (*segment | bit) : (*segment & ~bit);
+                ssd1306_mark_dirty(i2c_ssd1306, command->y1 / 8, command->y1 / 8, command->x1, command->x1);
+            }
+            break;
+        case SSD1306_LIST_FILL_RECT:
+            if (ssd1306_list_fill(i2c_ssd1306, width, height, command->x1, command->x1 + command->x2 - 1, command->y1, command->y1 + command->y2 - 1, command->fill))
+                ssd1306_list_mark(i2c_ssd1306, width, height, command->x1, command->x1 + command->x2 - 1, command->y1, command->y1 + command->y2 - 1);
+            break;
+        case SSD1306_LIST_RECT:
+        {
+            /* Outline as i2c_ssd1306_buffer_round_rect() draws it with no radius: full-height sides, then top and bottom between them. */
+            int32_t x1 = command->x1, y1 = command->y1;
+            int32_t x2 = x1 + command->x2 - 1, y2 = y1 + command->y2 - 1;
+            if (command->x2 == 0 || command->y2 == 0)
+                break;
+            ssd1306_list_fill(i2c_ssd1306, width, height, x1, x1, y1, y2, command->fill);
+            ssd1306_list_fill(i2c_ssd1306, width, height, x2, x2, y1, y2, command->fill);
+            ssd1306_list_fill(i2c_ssd1306, width, height, x1 + 1, x2 - 1, y1, y1, command->fill);
+            ssd1306_list_fill(i2c_ssd1306, width, height, x1 + 1, x2 - 1, y2, y2, command->fill);
+            ssd1306_list_mark(i2c_ssd1306, width, height, x1, x2, y1, y2);
+            break;
+        }
+        case SSD1306_LIST_LINE:
+            ssd1306_draw_line(i2c_ssd1306, command->x1, command->y1, command->x2, command->y2, command->fill);
+            break;
+        case SSD1306_LIST_CIRCLE:
+            ssd1306_draw_circle(i2c_ssd1306, command->x1, command->y1, command->x2, false, command->fill);
+            break;
+        case SSD1306_LIST_FILL_CIRCLE:
+            ssd1306_draw_circle(i2c_ssd1306, command->x1, command->y1, command->x2, true, command->fill);
+            break;
+        case SSD1306_LIST_TEXT:
+            if (command->x1 < width && command->y1 < height)
+                ssd1306_draw_text(i2c_ssd1306, command->x1, command->y1, command->data.text.text, command->data.text.font, command->fill, command->rop);
+            break;
+        case SSD1306_LIST_SPRITE:
+            ssd1306_draw_sprite(i2c_ssd1306, command->x1, command->y1, command->data.sprite, command->rop);
+            break;
+        }
+    }
+}
+
+esp_err_t i2c_ssd1306_list_submit(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_list_t *list)
+{
+    if (!list->validated)
+    {
+        esp_err_t ret = ssd1306_list_validate(list);
+        if (ret != ESP_OK)
+            return ret;
+    }
+    SSD1306_SPECIALIZE(i2c_ssd1306, ssd1306_list_run, list);
+
+    return ESP_OK;
+}
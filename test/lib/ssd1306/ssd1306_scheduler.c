@@ -0,0 +1,327 @@
+#include <stdlib.h>
+#include <esp_timer.h>
+#include "freertos/semphr.h"
+#include "ssd1306.h"
+#include "ssd1306_const.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Locking: 'table' guards the slot table and the idle decision and is only held briefly. Each slot has its own
+ * 'lock', held by the task for a whole turn of that display and by present while it copies into the front
+ * buffer, so presenting one display never waits for a turn of another one. 'table' is always taken before
+ * a slot lock, never while holding one.
+ */
+
+typedef struct
+{
+    i2c_ssd1306_handle_t *display; // NULL while the slot is free
+    SemaphoreHandle_t lock;        // Guards the fields below
+    uint8_t *front_storage;        // Front buffer, header included
+    uint8_t *front;                // Pixels of the front buffer
+    ssd1306_dirty_t pending;       // Presented windows not sent yet
+    bool failed;                   // Last turn failed, retried with the next present
+} ssd1306_scheduler_slot_t;
+
+struct ssd1306_scheduler
+{
+    TaskHandle_t task;
+    SemaphoreHandle_t table;
+    SemaphoreHandle_t idle;        // Given while nothing presented is pending
+    uint16_t budget_bytes;
+    uint8_t next;                  // Slot that gets the next turn
+    ssd1306_frame_done_cb_t on_frame_done;
+    void *user_ctx;
+    esp_err_t last_err;
+    ssd1306_scheduler_slot_t slots[SSD1306_SCHEDULER_MAX_DISPLAYS];
+};
+
+/* Send pending page windows of one display until its budget is used up. Called with the slot lock held. */
+static void ssd1306_scheduler_turn(ssd1306_scheduler_t *scheduler, ssd1306_scheduler_slot_t *slot)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = slot->display;
+    esp_err_t err = ESP_OK;
+
+    int64_t start = esp_timer_get_time();
+    i2c_ssd1306->flush_wire_bytes = 0;
+    for (uint8_t page = 0; page < i2c_ssd1306->total_pages && i2c_ssd1306->flush_wire_bytes < scheduler->budget_bytes; page++)
+    {
+        if (!(slot->pending.pages & (1 << page)))
+            continue;
+        err = ssd1306_window_to_ram(i2c_ssd1306, slot->front, page, page, slot->pending.start[page], slot->pending.end[page]);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(SSD1306_TAG, "Failed to flush the front buffer to the RAM of the SSD1306 device");
+            slot->failed = true;
+            break;
+        }
+        slot->pending.pages &= ~(1 << page);
+    }
+    ssd1306_stats_frame(i2c_ssd1306, start, err);
+    scheduler->last_err = err;
+
+    if (scheduler->on_frame_done && (err != ESP_OK || slot->pending.pages == 0))
+        scheduler->on_frame_done(i2c_ssd1306, err, scheduler->user_ctx);
+}
+
+/* Pick the next display with pending windows, round-robin, and return it with its lock held. */
+static ssd1306_scheduler_slot_t *ssd1306_scheduler_next(ssd1306_scheduler_t *scheduler)
+{
+    for (uint8_t i = 0; i < SSD1306_SCHEDULER_MAX_DISPLAYS; i++)
+    {
+        uint8_t index = (scheduler->next + i) % SSD1306_SCHEDULER_MAX_DISPLAYS;
+        ssd1306_scheduler_slot_t *slot = &scheduler->slots[index];
+        if (slot->display == NULL)
+            continue;
+        xSemaphoreTake(slot->lock, portMAX_DELAY);
+        if (slot->pending.pages && !slot->failed)
+        {
+            scheduler->next = (index + 1) % SSD1306_SCHEDULER_MAX_DISPLAYS;
+            return slot;
+        }
+        xSemaphoreGive(slot->lock);
+    }
+
+    return NULL;
+}
+
+static void ssd1306_scheduler_task(void *arg)
+{
+    ssd1306_scheduler_t *scheduler = (ssd1306_scheduler_t *)arg;
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        while (1)
+        {
+            xSemaphoreTake(scheduler->table, portMAX_DELAY);
+            ssd1306_scheduler_slot_t *slot = ssd1306_scheduler_next(scheduler);
+            if (slot == NULL)
+            {
+                /* Decided under 'table', which present takes after queueing its windows. */
+                xSemaphoreGive(scheduler->idle);
+                xSemaphoreGive(scheduler->table);
+                break;
+            }
+            xSemaphoreGive(scheduler->table);
+
+            ssd1306_scheduler_turn(scheduler, slot);
+            xSemaphoreGive(slot->lock);
+        }
+    }
+}
+
+static ssd1306_scheduler_slot_t *ssd1306_scheduler_slot(ssd1306_scheduler_t *scheduler, i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    for (uint8_t i = 0; i < SSD1306_SCHEDULER_MAX_DISPLAYS; i++)
+    {
+        if (scheduler->slots[i].display == i2c_ssd1306)
+            return &scheduler->slots[i];
+    }
+
+    return NULL;
+}
+
+static void ssd1306_scheduler_free_slot(ssd1306_scheduler_slot_t *slot)
+{
+    slot->display->scheduler = NULL;
+    slot->display = NULL;
+    vSemaphoreDelete(slot->lock);
+    free(slot->front_storage);
+}
+
+esp_err_t i2c_ssd1306_scheduler_create(const i2c_ssd1306_scheduler_config_t *scheduler_config, ssd1306_scheduler_t **scheduler)
+{
+    if (scheduler_config->budget_bytes == 0)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid SSD1306 scheduler configuration, 'budget_bytes' must be greater than 0");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_scheduler_t *new_scheduler = (ssd1306_scheduler_t *)calloc(1, sizeof(ssd1306_scheduler_t));
+    if (new_scheduler == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 scheduler");
+        return ESP_ERR_NO_MEM;
+    }
+    new_scheduler->table = xSemaphoreCreateMutex();
+    new_scheduler->idle = xSemaphoreCreateBinary();
+    if (new_scheduler->table == NULL || new_scheduler->idle == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 scheduler");
+        if (new_scheduler->table)
+            vSemaphoreDelete(new_scheduler->table);
+        if (new_scheduler->idle)
+            vSemaphoreDelete(new_scheduler->idle);
+        free(new_scheduler);
+        return ESP_ERR_NO_MEM;
+    }
+    new_scheduler->budget_bytes = scheduler_config->budget_bytes;
+    new_scheduler->on_frame_done = scheduler_config->on_frame_done;
+    new_scheduler->user_ctx = scheduler_config->user_ctx;
+    new_scheduler->last_err = ESP_OK;
+    xSemaphoreGive(new_scheduler->idle);
+
+    if (xTaskCreatePinnedToCore(ssd1306_scheduler_task, "ssd1306_sched", scheduler_config->task_stack_size, new_scheduler,
+                                scheduler_config->task_priority, &new_scheduler->task, scheduler_config->task_core_id) != pdPASS)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to create the SSD1306 scheduler task");
+        vSemaphoreDelete(new_scheduler->table);
+        vSemaphoreDelete(new_scheduler->idle);
+        free(new_scheduler);
+        return ESP_ERR_NO_MEM;
+    }
+    *scheduler = new_scheduler;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_scheduler_delete(ssd1306_scheduler_t *scheduler)
+{
+    /* Once idle, the task only waits for its notification and holds nothing when deleted. */
+    xSemaphoreTake(scheduler->table, portMAX_DELAY);
+    for (uint8_t i = 0; i < SSD1306_SCHEDULER_MAX_DISPLAYS; i++)
+    {
+        ssd1306_scheduler_slot_t *slot = &scheduler->slots[i];
+        if (slot->display == NULL)
+            continue;
+        xSemaphoreTake(slot->lock, portMAX_DELAY);
+        slot->pending.pages = 0;
+        xSemaphoreGive(slot->lock);
+    }
+    xSemaphoreGive(scheduler->table);
+    i2c_ssd1306_scheduler_wait(scheduler, portMAX_DELAY);
+    vTaskDelete(scheduler->task);
+
+    for (uint8_t i = 0; i < SSD1306_SCHEDULER_MAX_DISPLAYS; i++)
+    {
+        if (scheduler->slots[i].display)
+            ssd1306_scheduler_free_slot(&scheduler->slots[i]);
+    }
+    vSemaphoreDelete(scheduler->table);
+    vSemaphoreDelete(scheduler->idle);
+    free(scheduler);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_scheduler_add(ssd1306_scheduler_t *scheduler, i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    if (i2c_ssd1306->async != NULL || i2c_ssd1306->scheduler != NULL || i2c_ssd1306->gray != NULL || i2c_ssd1306->console != NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 flush task is running, or the display is already scheduled, in grayscale mode or a console");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint8_t *front_storage = (uint8_t *)calloc(1, SSD1306_FRAMEBUFFER_SIZE(i2c_ssd1306->width, i2c_ssd1306->height));
+    SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+    if (front_storage == NULL || lock == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to allocate memory for the SSD1306 front buffer");
+        free(front_storage);
+        if (lock)
+            vSemaphoreDelete(lock);
+        return ESP_ERR_NO_MEM;
+    }
+
+    xSemaphoreTake(scheduler->table, portMAX_DELAY);
+    ssd1306_scheduler_slot_t *slot = ssd1306_scheduler_slot(scheduler, NULL);
+    if (slot == NULL)
+    {
+        xSemaphoreGive(scheduler->table);
+        free(front_storage);
+        vSemaphoreDelete(lock);
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 scheduler already serves %d displays", SSD1306_SCHEDULER_MAX_DISPLAYS);
+        return ESP_ERR_NO_MEM;
+    }
+    slot->lock = lock;
+    slot->front_storage = front_storage;
+    slot->front = front_storage + SSD1306_FRAMEBUFFER_HEADER;
+    slot->front[-1] = OLED_CONTROL_BYTE_DATA;
+    slot->pending.pages = 0;
+    slot->failed = false;
+    slot->display = i2c_ssd1306;
+    i2c_ssd1306->scheduler = scheduler;
+    xSemaphoreGive(scheduler->table);
+
+    /* The front buffer starts blank; the first present copies everything that differs from it. */
+    ssd1306_mark_all_dirty(i2c_ssd1306);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_scheduler_remove(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_scheduler_t *scheduler = i2c_ssd1306->scheduler;
+    if (scheduler == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 display is not scheduled");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(scheduler->table, portMAX_DELAY);
+    ssd1306_scheduler_slot_t *slot = ssd1306_scheduler_slot(scheduler, i2c_ssd1306);
+    /* Waits for the turn in flight; the task cannot pick the slot again without 'table'. */
+    xSemaphoreTake(slot->lock, portMAX_DELAY);
+    /* Whatever was not sent is not in the display RAM either. */
+    for (uint8_t page = 0; page < i2c_ssd1306->total_pages; page++)
+    {
+        if (slot->pending.pages & (1 << page))
+            ssd1306_mark_dirty(i2c_ssd1306, page, page, slot->pending.start[page], slot->pending.end[page]);
+    }
+    xSemaphoreGive(slot->lock);
+    ssd1306_scheduler_free_slot(slot);
+    xSemaphoreGive(scheduler->table);
+
+    return ESP_OK;
+}
+
+esp_err_t ssd1306_scheduler_present(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_scheduler_t *scheduler = i2c_ssd1306->scheduler;
+    /* Only the table lookup needs 'table'; the slot of a scheduled display does not move until it is removed. */
+    xSemaphoreTake(scheduler->table, portMAX_DELAY);
+    ssd1306_scheduler_slot_t *slot = ssd1306_scheduler_slot(scheduler, i2c_ssd1306);
+    xSemaphoreGive(scheduler->table);
+
+    xSemaphoreTake(slot->lock, portMAX_DELAY);
+    if (i2c_ssd1306->dirty.pages == 0 && !slot->failed)
+    {
+        xSemaphoreGive(slot->lock);
+        return ESP_OK;
+    }
+    ssd1306_dirty_copy(i2c_ssd1306, slot->front, &slot->pending);
+    slot->failed = false;
+    xSemaphoreGive(slot->lock);
+
+    xSemaphoreTake(scheduler->table, portMAX_DELAY);
+    xSemaphoreTake(scheduler->idle, 0);
+    xSemaphoreGive(scheduler->table);
+    xTaskNotifyGive(scheduler->task);
+
+    return ESP_OK;
+}
+
+uint8_t *ssd1306_scheduler_front_acquire(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_dirty_t **pending, SemaphoreHandle_t *lock)
+{
+    ssd1306_scheduler_t *scheduler = i2c_ssd1306->scheduler;
+    xSemaphoreTake(scheduler->table, portMAX_DELAY);
+    ssd1306_scheduler_slot_t *slot = ssd1306_scheduler_slot(scheduler, i2c_ssd1306);
+    xSemaphoreGive(scheduler->table);
+
+    /* The caller gives the slot lock back directly; looking the slot up again would take 'table' under it. */
+    xSemaphoreTake(slot->lock, portMAX_DELAY);
+    *pending = &slot->pending;
+    *lock = slot->lock;
+
+    return slot->front;
+}
+
+esp_err_t i2c_ssd1306_scheduler_wait(ssd1306_scheduler_t *scheduler, TickType_t timeout)
+{
+    if (xSemaphoreTake(scheduler->idle, timeout) != pdTRUE)
+        return ESP_ERR_TIMEOUT;
+    xSemaphoreGive(scheduler->idle);
+
+    return scheduler->last_err;
+}
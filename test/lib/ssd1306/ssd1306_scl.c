@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <nvs.h>
+#include "ssd1306.h"
+#include "ssd1306_internal.h"
+
+#define SSD1306_SCL_NVS_NAMESPACE "ssd1306"
+
+/* Re-add the device at 'scl_speed_hz'; the I2C master driver fixes the rate of a device when it is added. */
+static esp_err_t ssd1306_scl_apply(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_handle_t *i2c_ssd1306, uint32_t scl_speed_hz)
+{
+    if (i2c_ssd1306->i2c_master_dev != NULL && scl_speed_hz == i2c_ssd1306->i2c_scl_speed_hz)
+        return ESP_OK;
+
+    if (i2c_ssd1306->i2c_master_dev != NULL)
+    {
+        esp_err_t err = i2c_master_bus_rm_device(i2c_ssd1306->i2c_master_dev);
+        if (err != ESP_OK)
+            return err;
+        i2c_ssd1306->i2c_master_dev = NULL;
+    }
+    i2c_device_config_t i2c_device_config = {
+        .dev_addr_length = I2C_ADDR_BIT_7,
+        .device_address = i2c_ssd1306->i2c_device_address,
+        .scl_speed_hz = scl_speed_hz};
+    esp_err_t err = i2c_master_bus_add_device(i2c_master_bus, &i2c_device_config, &i2c_ssd1306->i2c_master_dev);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to add I2C SSD1306 device at %lu Hz", (unsigned long)scl_speed_hz);
+        /* Fall back to the rate that worked; if even that fails, the next apply adds the device from scratch. */
+        i2c_device_config.scl_speed_hz = i2c_ssd1306->i2c_scl_speed_hz;
+        if (i2c_master_bus_add_device(i2c_master_bus, &i2c_device_config, &i2c_ssd1306->i2c_master_dev) != ESP_OK)
+            i2c_ssd1306->i2c_master_dev = NULL;
+        return err;
+    }
+    i2c_ssd1306->i2c_scl_speed_hz = scl_speed_hz;
+
+    return ESP_OK;
+}
+
+/* Push 'frames' full frames and stop at the first failed transaction. */
+static esp_err_t ssd1306_scl_verify(i2c_ssd1306_handle_t *i2c_ssd1306, uint16_t frames)
+{
+    for (uint16_t i = 0; i < frames; i++)
+    {
+        esp_err_t err = i2c_ssd1306_buffer_to_ram(i2c_ssd1306);
+        if (err != ESP_OK)
+            return err;
+    }
+
+    return ESP_OK;
+}
+
+static void ssd1306_scl_key(const i2c_ssd1306_handle_t *i2c_ssd1306, char *key, size_t size)
+{
+    snprintf(key, size, "scl_%02x", i2c_ssd1306->i2c_device_address);
+}
+
+static uint32_t ssd1306_scl_load(const i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    nvs_handle_t nvs;
+    uint32_t scl_speed_hz = 0;
+    char key[16];
+    if (nvs_open(SSD1306_SCL_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK)
+        return 0;
+    ssd1306_scl_key(i2c_ssd1306, key, sizeof(key));
+    if (nvs_get_u32(nvs, key, &scl_speed_hz) != ESP_OK)
+        scl_speed_hz = 0;
+    nvs_close(nvs);
+
+    return scl_speed_hz;
+}
+
+static void ssd1306_scl_store(const i2c_ssd1306_handle_t *i2c_ssd1306, uint32_t scl_speed_hz)
+{
+    nvs_handle_t nvs;
+    char key[16];
+    esp_err_t err = nvs_open(SSD1306_SCL_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK)
+    {
+        ssd1306_scl_key(i2c_ssd1306, key, sizeof(key));
+        err = nvs_set_u32(nvs, key, scl_speed_hz);
+        if (err == ESP_OK)
+            err = nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK)
+        ESP_LOGW(SSD1306_TAG, "Failed to persist the SCL rate: %s", esp_err_to_name(err));
+}
+
+esp_err_t i2c_ssd1306_scl_calibrate(i2c_master_bus_handle_t i2c_master_bus, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_scl_calibration_config_t *calibration_config, uint32_t *scl_speed_hz)
+{
+    const i2c_ssd1306_scl_calibration_config_t *config = calibration_config;
+    if (config->start_hz == 0 || config->start_hz > config->max_hz || config->step_hz == 0 || config->frames_per_step == 0)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid SCL calibration, 'start_hz' must be between 1 and 'max_hz', 'step_hz' and 'frames_per_step' must not be 0");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (i2c_ssd1306->async != NULL || i2c_ssd1306->scheduler != NULL || i2c_ssd1306->gray != NULL || i2c_ssd1306->console != NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SCL rate can not be calibrated while a flush task, a scheduler, the grayscale mode or a console owns the display");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint32_t previous_hz = i2c_ssd1306->i2c_scl_speed_hz;
+    uint32_t stored_hz = config->use_stored ? ssd1306_scl_load(i2c_ssd1306) : 0;
+    if (stored_hz >= config->start_hz && stored_hz <= config->max_hz)
+    {
+        if (ssd1306_scl_apply(i2c_master_bus, i2c_ssd1306, stored_hz) == ESP_OK && ssd1306_scl_verify(i2c_ssd1306, 1) == ESP_OK)
+        {
+            ESP_LOGI(SSD1306_TAG, "Using the stored SCL rate of %lu Hz", (unsigned long)stored_hz);
+            if (scl_speed_hz)
+                *scl_speed_hz = stored_hz;
+            return ESP_OK;
+        }
+        ESP_LOGW(SSD1306_TAG, "The stored SCL rate of %lu Hz failed, calibrating again", (unsigned long)stored_hz);
+    }
+
+    /* Sweep up to the first step with a failed transaction; every failure can cost a whole I2C timeout. */
+    uint32_t fastest_hz = 0;
+    esp_err_t err = ESP_OK;
+    for (uint32_t hz = config->start_hz; hz <= config->max_hz; hz += config->step_hz)
+    {
+        err = ssd1306_scl_apply(i2c_master_bus, i2c_ssd1306, hz);
+        if (err == ESP_OK)
+            err = ssd1306_scl_verify(i2c_ssd1306, config->frames_per_step);
+        if (err != ESP_OK)
+        {
+            ESP_LOGI(SSD1306_TAG, "SCL rate of %lu Hz failed: %s", (unsigned long)hz, esp_err_to_name(err));
+            break;
+        }
+        fastest_hz = hz;
+    }
+    if (fastest_hz == 0)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 device fails at the calibration start rate of %lu Hz", (unsigned long)config->start_hz);
+        ssd1306_scl_apply(i2c_master_bus, i2c_ssd1306, previous_hz);
+        return err;
+    }
+
+    uint32_t margin_hz = (uint32_t)config->margin_steps * config->step_hz;
+    uint32_t settled_hz = (fastest_hz - config->start_hz > margin_hz) ? fastest_hz - margin_hz : config->start_hz;
+    err = ssd1306_scl_apply(i2c_master_bus, i2c_ssd1306, settled_hz);
+    if (err == ESP_OK)
+        err = ssd1306_scl_verify(i2c_ssd1306, 1);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "The SSD1306 device fails at the settled SCL rate of %lu Hz", (unsigned long)settled_hz);
+        ssd1306_scl_apply(i2c_master_bus, i2c_ssd1306, previous_hz);
+        return err;
+    }
+
+    ESP_LOGI(SSD1306_TAG, "SCL rate calibrated to %lu Hz (fastest passing %lu Hz)", (unsigned long)settled_hz, (unsigned long)fastest_hz);
+    ssd1306_scl_store(i2c_ssd1306, settled_hz);
+    if (scl_speed_hz)
+        *scl_speed_hz = settled_hz;
+
+    return ESP_OK;
+}
@@ -0,0 +1,183 @@
+#include "ssd1306.h"
+#include "ssd1306_const.h"
+#include "ssd1306_internal.h"
+
+/* Scroll commands must not interleave with a frame the flush task or the scheduler is sending. */
+static void ssd1306_scroll_wait_idle(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    if (i2c_ssd1306->async)
+        i2c_ssd1306_async_wait(i2c_ssd1306, portMAX_DELAY);
+    else if (i2c_ssd1306->scheduler)
+        i2c_ssd1306_scheduler_wait(i2c_ssd1306->scheduler, portMAX_DELAY);
+}
+
+/* Rotate the 'length' + 1 columns of one page at 'window' by one column, like the content scroll command does. */
+static void ssd1306_scroll_rotate(uint8_t *window, uint8_t length, ssd1306_scroll_direction_t direction)
+{
+    if (direction == SSD1306_SCROLL_RIGHT)
+    {
+        uint8_t wrapped = window[length];
+        memmove(window + 1, window, length);
+        window[0] = wrapped;
+    }
+    else
+    {
+        uint8_t wrapped = window[0];
+        memmove(window, window + 1, length);
+        window[length] = wrapped;
+    }
+}
+
+/* Whether 'dirty' has a window on 'page' that reaches into segments 'initial_segment'..'final_segment'. */
+static bool ssd1306_dirty_overlaps(const ssd1306_dirty_t *dirty, uint8_t page, uint8_t initial_segment, uint8_t final_segment)
+{
+    return (dirty->pages & (1 << page)) && dirty->start[page] <= final_segment && dirty->end[page] >= initial_segment;
+}
+
+esp_err_t i2c_ssd1306_scroll_horizontal(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_scroll_direction_t direction, uint8_t initial_page, uint8_t final_page, ssd1306_scroll_speed_t speed)
+{
+    if (initial_page >= i2c_ssd1306->total_pages || final_page >= i2c_ssd1306->total_pages || initial_page > final_page)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid page range, 'initial_page' and 'final_page' must be between 0 and %d, 'initial_page' must be less than or equal to 'final_page'", i2c_ssd1306->total_pages - 1);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_scroll_wait_idle(i2c_ssd1306);
+    /* The setup must not change while a scroll runs, so deactivate first. */
+    uint8_t scroll_cmd[] = {
+        OLED_CONTROL_BYTE_CMD,
+        OLED_CMD_DEACTIVATE_SCROLL,
+        (direction == SSD1306_SCROLL_RIGHT) ? OLED_CMD_RIGHT_HORIZONTAL_SCROLL : OLED_CMD_LEFT_HORIZONTAL_SCROLL,
+        0x00, initial_page, speed, final_page, 0x00, 0xFF,
+        OLED_CMD_ACTIVATE_SCROLL};
+    esp_err_t err = ssd1306_transmit(i2c_ssd1306, scroll_cmd, sizeof(scroll_cmd));
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to start the horizontal scroll of the SSD1306 device");
+        return err;
+    }
+    i2c_ssd1306->scroll_pages |= (uint8_t)((0xFF >> (7 - final_page)) & (0xFF << initial_page));
+
+    return err;
+}
+
+esp_err_t i2c_ssd1306_scroll_vertical(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_scroll_direction_t direction, uint8_t initial_page, uint8_t final_page, ssd1306_scroll_speed_t speed, uint8_t vertical_offset)
+{
+    if (initial_page >= SSD1306_MAX_PAGES || final_page >= SSD1306_MAX_PAGES || initial_page > final_page || vertical_offset >= i2c_ssd1306->scroll_rows)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid vertical scroll, 'initial_page' and 'final_page' must be between 0 and %d, 'initial_page' must be less than or equal to 'final_page', 'vertical_offset' must be less than %d", SSD1306_MAX_PAGES - 1, i2c_ssd1306->scroll_rows);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_scroll_wait_idle(i2c_ssd1306);
+    uint8_t scroll_cmd[] = {
+        OLED_CONTROL_BYTE_CMD,
+        OLED_CMD_DEACTIVATE_SCROLL,
+        OLED_CMD_SET_VERTICAL_SCROLL_AREA, i2c_ssd1306->scroll_fixed_rows, i2c_ssd1306->scroll_rows,
+        (direction == SSD1306_SCROLL_RIGHT) ? OLED_CMD_VERTICAL_RIGHT_HORIZONTAL_SCROLL : OLED_CMD_VERTICAL_LEFT_HORIZONTAL_SCROLL,
+        0x00, initial_page, speed, final_page, vertical_offset,
+        OLED_CMD_ACTIVATE_SCROLL};
+    esp_err_t err = ssd1306_transmit(i2c_ssd1306, scroll_cmd, sizeof(scroll_cmd));
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to start the vertical scroll of the SSD1306 device");
+        return err;
+    }
+    /* Rows move between pages, so every page has to be rewritten after the scroll. */
+    i2c_ssd1306->scroll_pages = (uint8_t)(0xFF >> (SSD1306_MAX_PAGES - i2c_ssd1306->total_pages));
+
+    return err;
+}
+
+esp_err_t i2c_ssd1306_scroll_area(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t fixed_rows, uint8_t scroll_rows)
+{
+    if (scroll_rows == 0 || fixed_rows + scroll_rows > i2c_ssd1306->height)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid vertical scroll area, 'scroll_rows' must be greater than 0 and 'fixed_rows' + 'scroll_rows' must be less than or equal to %d", i2c_ssd1306->height);
+        return ESP_ERR_INVALID_ARG;
+    }
+    i2c_ssd1306->scroll_fixed_rows = fixed_rows;
+    i2c_ssd1306->scroll_rows = scroll_rows;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_scroll_stop(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    uint8_t stop_cmd[] = {
+        OLED_CONTROL_BYTE_CMD,
+        OLED_CMD_DEACTIVATE_SCROLL,
+        OLED_MASK_DISPLAY_START_LINE | 0x00};
+    esp_err_t err = ssd1306_transmit(i2c_ssd1306, stop_cmd, sizeof(stop_cmd));
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(SSD1306_TAG, "Failed to stop the scroll of the SSD1306 device");
+        return err;
+    }
+    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+    {
+        if (i2c_ssd1306->scroll_pages & (1 << i))
+            ssd1306_mark_dirty(i2c_ssd1306, i, i, 0, i2c_ssd1306->width - 1);
+    }
+    i2c_ssd1306->scroll_pages = 0;
+
+    return err;
+}
+
+esp_err_t i2c_ssd1306_scroll_step(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_scroll_direction_t direction, uint8_t initial_page, uint8_t final_page, uint8_t initial_segment, uint8_t final_segment)
+{
+    if (initial_page >= i2c_ssd1306->total_pages || final_page >= i2c_ssd1306->total_pages || initial_page > final_page || final_segment >= i2c_ssd1306->width || initial_segment >= final_segment)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid scroll window, 'initial_page' and 'final_page' must be between 0 and %d, 'initial_segment' and 'final_segment' must be between 0 and %d, the initial values must be less than the final ones", i2c_ssd1306->total_pages - 1, i2c_ssd1306->width - 1);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (i2c_ssd1306->scroll_pages)
+    {
+        ESP_LOGE(SSD1306_TAG, "A continuous scroll of the SSD1306 device is running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ssd1306_scroll_wait_idle(i2c_ssd1306);
+    /* The front buffer of the flush task or scheduler mirrors the display RAM too, and is rotated with the task kept off it. */
+    ssd1306_dirty_t *front_pending = NULL;
+    SemaphoreHandle_t front_lock = NULL;
+    uint8_t *front = ssd1306_front_acquire(i2c_ssd1306, &front_pending, &front_lock);
+    uint8_t step_cmd[] = {
+        OLED_CONTROL_BYTE_CMD,
+        (direction == SSD1306_SCROLL_RIGHT) ? OLED_CMD_RIGHT_CONTENT_SCROLL : OLED_CMD_LEFT_CONTENT_SCROLL,
+        0x00, initial_page, 0x01, final_page, initial_segment, final_segment};
+    esp_err_t err = ssd1306_transmit(i2c_ssd1306, step_cmd, sizeof(step_cmd));
+    if (err != ESP_OK)
+    {
+        if (front)
+            xSemaphoreGive(front_lock);
+        ESP_LOGE(SSD1306_TAG, "Failed to scroll the window of the SSD1306 device");
+        return err;
+    }
+
+    /* Mirror the step in the framebuffer so that it keeps matching the display RAM. */
+    uint8_t length = final_segment - initial_segment;
+    uint8_t entry = (direction == SSD1306_SCROLL_RIGHT) ? initial_segment : final_segment;
+    for (uint8_t page = initial_page; page <= final_page; page++)
+    {
+        ssd1306_scroll_rotate(ssd1306_page(i2c_ssd1306, page) + initial_segment, length, direction);
+
+        /* Pending changes inside the window moved with it, and the entering column depends on the controller revision. */
+        if (ssd1306_dirty_overlaps(&i2c_ssd1306->dirty, page, initial_segment, final_segment))
+            ssd1306_mark_dirty(i2c_ssd1306, page, page, initial_segment, final_segment);
+        else
+            ssd1306_mark_dirty(i2c_ssd1306, page, page, entry, entry);
+
+        if (front)
+        {
+            ssd1306_scroll_rotate(front + page * i2c_ssd1306->width + initial_segment, length, direction);
+            /* Windows a failed flush left behind moved as well. */
+            if (ssd1306_dirty_overlaps(front_pending, page, initial_segment, final_segment))
+                ssd1306_dirty_add(front_pending, page, page, initial_segment, final_segment);
+        }
+    }
+    if (front)
+        xSemaphoreGive(front_lock);
+
+    return err;
+}
@@ -0,0 +1,126 @@
+#include <esp_timer.h>
+#include "ssd1306.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Flush telemetry. Every transaction costs two esp_timer reads and a few counter updates; every frame one more
+ * read and a histogram increment, so the counters can stay on in production.
+ */
+
+static uint8_t ssd1306_stats_bucket(uint32_t us)
+{
+    if (us < 2)
+        return us;
+    uint8_t octave = 31 - __builtin_clz(us);
+    uint8_t bucket = 2 * octave + ((us >> (octave - 1)) & 1);
+
+    return (bucket < SSD1306_STATS_LATENCY_BUCKETS) ? bucket : SSD1306_STATS_LATENCY_BUCKETS - 1;
+}
+
+static uint32_t ssd1306_stats_bucket_limit(uint8_t bucket)
+{
+    if (bucket < 2)
+        return bucket;
+    uint8_t octave = bucket / 2;
+    uint32_t half = 1u << (octave - 1);
+
+    return (1u << octave) + (bucket % 2) * half + half - 1;
+}
+
+static inline uint32_t ssd1306_stats_us(int64_t us)
+{
+    return (us < 0) ? 0 : (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+}
+
+void ssd1306_stats_transaction(i2c_ssd1306_handle_t *i2c_ssd1306, size_t wire_bytes, esp_err_t err, int64_t elapsed_us)
+{
+    ssd1306_stats_t *stats = &i2c_ssd1306->stats;
+    uint32_t elapsed = ssd1306_stats_us(elapsed_us);
+    stats->transactions++;
+    stats->bytes += wire_bytes;
+    if (elapsed > stats->worst_stall_us)
+        stats->worst_stall_us = elapsed;
+    if (err == ESP_OK)
+        return;
+
+    for (uint8_t i = 0; i < SSD1306_STATS_ERROR_CODES; i++)
+    {
+        if (stats->errors[i].count == 0 || stats->errors[i].code == err)
+        {
+            stats->errors[i].code = err;
+            stats->errors[i].count++;
+            return;
+        }
+    }
+    stats->other_errors++;
+}
+
+void ssd1306_stats_frame(i2c_ssd1306_handle_t *i2c_ssd1306, int64_t start_us, esp_err_t err)
+{
+    if (i2c_ssd1306->flush_wire_bytes == 0)
+        return;
+
+    ssd1306_stats_t *stats = &i2c_ssd1306->stats;
+    uint32_t latency = ssd1306_stats_us(esp_timer_get_time() - start_us);
+    stats->frames++;
+    if (err != ESP_OK)
+        stats->failed_frames++;
+    if (latency > stats->worst_latency_us)
+        stats->worst_latency_us = latency;
+    stats->latency_histogram[ssd1306_stats_bucket(latency)]++;
+}
+
+esp_err_t i2c_ssd1306_stats_get(const i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid telemetry destination");
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = i2c_ssd1306->stats;
+
+    return ESP_OK;
+}
+
+void i2c_ssd1306_stats_reset(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    memset(&i2c_ssd1306->stats, 0, sizeof(i2c_ssd1306->stats));
+}
+
+uint32_t i2c_ssd1306_stats_latency_percentile(const ssd1306_stats_t *stats, uint8_t percentile)
+{
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < SSD1306_STATS_LATENCY_BUCKETS; i++)
+        total += stats->latency_histogram[i];
+    if (total == 0)
+        return 0;
+
+    /* Rank of the percentile frame, rounded up so that p100 is the slowest frame. */
+    uint64_t rank = ((uint64_t)total * percentile + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < SSD1306_STATS_LATENCY_BUCKETS; i++)
+    {
+        seen += stats->latency_histogram[i];
+        if (seen < rank || stats->latency_histogram[i] == 0)
+            continue;
+        /* No frame took longer than the worst one, which also bounds the open-ended last bucket. */
+        uint32_t limit = ssd1306_stats_bucket_limit(i);
+        return (i == SSD1306_STATS_LATENCY_BUCKETS - 1 || limit > stats->worst_latency_us) ? stats->worst_latency_us : limit;
+    }
+
+    return stats->worst_latency_us;
+}
+
+void i2c_ssd1306_stats_dump(const i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    const ssd1306_stats_t *stats = &i2c_ssd1306->stats;
+    ESP_LOGI(SSD1306_TAG, "Frames: %lu (%lu failed), transactions: %lu, bytes: %llu",
+             (unsigned long)stats->frames, (unsigned long)stats->failed_frames, (unsigned long)stats->transactions, (unsigned long long)stats->bytes);
+    ESP_LOGI(SSD1306_TAG, "Frame latency: p50 <= %lu us, p99 <= %lu us, worst %lu us; worst stall %lu us",
+             (unsigned long)i2c_ssd1306_stats_latency_percentile(stats, 50), (unsigned long)i2c_ssd1306_stats_latency_percentile(stats, 99),
+             (unsigned long)stats->worst_latency_us, (unsigned long)stats->worst_stall_us);
+    for (uint8_t i = 0; i < SSD1306_STATS_ERROR_CODES && stats->errors[i].count; i++)
+        ESP_LOGI(SSD1306_TAG, "I2C errors %s: %lu", esp_err_to_name(stats->errors[i].code), (unsigned long)stats->errors[i].count);
+    if (stats->other_errors)
+        ESP_LOGI(SSD1306_TAG, "I2C errors, other codes: %lu", (unsigned long)stats->other_errors);
+}
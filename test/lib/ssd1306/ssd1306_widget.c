@@ -0,0 +1,312 @@
+#include "ssd1306.h"
+#include "ssd1306_internal.h"
+
+/*
+ * Retained widgets. A widget remembers what it shows, so a setter that does not change it returns without
+ * touching the buffer, and one that does clears and redraws only the widget's box and marks only the box dirty.
+ * The next dirty flush or present then sends just the segments of the changed widgets.
+ */
+
+/* Longest text a widget renders: a prefix, an int32_t and a suffix. */
+#define SSD1306_WIDGET_RENDER_MAX (SSD1306_WIDGET_TEXT_MAX + 12)
+
+/* Append 'text' to 'buffer', dropping what does not fit together with any sequence the cut would split. */
+static void ssd1306_widget_append(char *buffer, size_t size, size_t *length, const char *text)
+{
+    if (!text)
+        return;
+    size_t start = *length;
+    while (*text && *length + 1 < size)
+        buffer[(*length)++] = *text++;
+    if (*text)
+    {
+        /* Back off to the lead byte of the last sequence and drop it; it may have lost continuation bytes. */
+        while (*length > start && ((uint8_t)buffer[*length - 1] & 0xC0) == 0x80)
+            (*length)--;
+        if (*length > start && (uint8_t)buffer[*length - 1] >= 0xC0)
+            (*length)--;
+    }
+    buffer[*length] = '\0';
+}
+
+/* Cut 'text' after the last glyph that fits 'width' pixels and return the width of what is left. */
+static uint16_t ssd1306_widget_fit(const ssd1306_font_t *font, char *text, uint8_t width)
+{
+    uint16_t pen = 0;
+    const char *cursor = text;
+    while (*cursor)
+    {
+        char *glyph_start = (char *)cursor;
+        const ssd1306_glyph_t *glyph = ssd1306_font_glyph(font, ssd1306_utf8_next(&cursor));
+        uint16_t cell = (glyph->advance > glyph->width) ? glyph->advance : glyph->width;
+        if (pen + cell > width)
+        {
+            *glyph_start = '\0';
+            break;
+        }
+        pen += glyph->advance;
+    }
+
+    return pen;
+}
+
+static uint8_t ssd1306_widget_align(const i2c_ssd1306_widget_config_t *config, uint16_t content_width)
+{
+    switch (config->align)
+    {
+    case SSD1306_ALIGN_CENTER:
+        return config->x + (config->width - content_width) / 2;
+    case SSD1306_ALIGN_RIGHT:
+        return config->x + config->width - content_width;
+    default:
+        return config->x;
+    }
+}
+
+/* Columns of the bar's inner area filled for 'value'. */
+static uint8_t ssd1306_widget_bar_fill(const i2c_ssd1306_widget_t *widget, int32_t value)
+{
+    uint8_t inner = widget->config.width - 4;
+    if (value <= widget->min)
+        return 0;
+    if (value >= widget->max)
+        return inner;
+
+    return (uint8_t)(((int64_t)value - widget->min) * inner / ((int64_t)widget->max - widget->min));
+}
+
+static void ssd1306_widget_text(i2c_ssd1306_widget_t *widget, char *text)
+{
+    const i2c_ssd1306_widget_config_t *config = &widget->config;
+    uint16_t text_width = ssd1306_widget_fit(config->font, text, config->width);
+    if (text[0] == '\0')
+        return;
+    uint8_t y = config->y + (config->height - config->font->height) / 2;
+    i2c_ssd1306_buffer_text_font(widget->i2c_ssd1306, ssd1306_widget_align(config, text_width), y, text, config->font, config->invert, SSD1306_ROP_COPY);
+}
+
+static void ssd1306_widget_render(i2c_ssd1306_widget_t *widget)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = widget->i2c_ssd1306;
+    const i2c_ssd1306_widget_config_t *config = &widget->config;
+    uint8_t x2 = config->x + config->width - 1;
+    uint8_t y2 = config->y + config->height - 1;
+    ssd1306_fill_rect(i2c_ssd1306, config->x, x2, config->y, y2, config->invert);
+
+    char text[SSD1306_WIDGET_RENDER_MAX];
+    size_t length = 0;
+    switch (widget->type)
+    {
+    case SSD1306_WIDGET_LABEL:
+        ssd1306_widget_append(text, sizeof(text), &length, widget->text);
+        ssd1306_widget_text(widget, text);
+        break;
+    case SSD1306_WIDGET_VALUE:
+    {
+        char digits[12];
+        uint8_t start = sizeof(digits) - 1;
+        uint32_t magnitude = (widget->value < 0) ? 0u - (uint32_t)widget->value : (uint32_t)widget->value;
+        digits[start] = '\0';
+        do
+        {
+            digits[--start] = '0' + magnitude % 10;
+            magnitude /= 10;
+        } while (magnitude);
+        if (widget->value < 0)
+            digits[--start] = '-';
+        text[0] = '\0';
+        ssd1306_widget_append(text, sizeof(text), &length, widget->prefix);
+        ssd1306_widget_append(text, sizeof(text), &length, &digits[start]);
+        ssd1306_widget_append(text, sizeof(text), &length, widget->suffix);
+        ssd1306_widget_text(widget, text);
+        break;
+    }
+    case SSD1306_WIDGET_ICON:
+        if (widget->sprite)
+        {
+            /* The box is already cleared to the background, so the sprite only has to set or clear its pixels. */
+            int16_t y = config->y + (config->height - widget->sprite->height) / 2;
+            i2c_ssd1306_buffer_sprite(i2c_ssd1306, ssd1306_widget_align(config, widget->sprite->width), y, widget->sprite, config->invert ? SSD1306_ROP_AND_NOT : SSD1306_ROP_OR);
+        }
+        break;
+    case SSD1306_WIDGET_BAR:
+    {
+        bool ink = !config->invert;
+        ssd1306_fill_rect(i2c_ssd1306, config->x, x2, config->y, config->y, ink);
+        ssd1306_fill_rect(i2c_ssd1306, config->x, x2, y2, y2, ink);
+        ssd1306_fill_rect(i2c_ssd1306, config->x, config->x, config->y, y2, ink);
+        ssd1306_fill_rect(i2c_ssd1306, x2, x2, config->y, y2, ink);
+        uint8_t fill = ssd1306_widget_bar_fill(widget, widget->value);
+        if (fill)
+            ssd1306_fill_rect(i2c_ssd1306, config->x + 2, config->x + 1 + fill, config->y + 2, y2 - 2, ink);
+        break;
+    }
+    }
+
+    ssd1306_mark_dirty(i2c_ssd1306, config->y / 8, y2 / 8, config->x, x2);
+}
+
+static esp_err_t ssd1306_widget_init(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, ssd1306_widget_type_t type)
+{
+    if (!widget || !i2c_ssd1306 || !config || config->width == 0 || config->height == 0 ||
+        config->x + config->width > i2c_ssd1306->width || config->y + config->height > i2c_ssd1306->height)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid widget box: x=%d, y=%d, %dx%d", config ? config->x : 0, config ? config->y : 0, config ? config->width : 0, config ? config->height : 0);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(widget, 0, sizeof(*widget));
+    widget->type = type;
+    widget->i2c_ssd1306 = i2c_ssd1306;
+    widget->config = *config;
+    if (!widget->config.font)
+        widget->config.font = &ssd1306_font_8x8;
+    if ((type == SSD1306_WIDGET_LABEL || type == SSD1306_WIDGET_VALUE) && widget->config.font->height > config->height)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid widget box: %d rows are lower than the %d-row font", config->height, widget->config.font->height);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return ESP_OK;
+}
+
+static bool ssd1306_widget_sprite_fits(const i2c_ssd1306_widget_t *widget, const ssd1306_sprite_t *sprite)
+{
+    if (sprite && (!sprite->bitmap || sprite->width > widget->config.width || sprite->height > widget->config.height))
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid icon: sprite does not fit the %dx%d box", widget->config.width, widget->config.height);
+        return false;
+    }
+
+    return true;
+}
+
+esp_err_t i2c_ssd1306_widget_label(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, const char *text)
+{
+    esp_err_t ret = ssd1306_widget_init(widget, i2c_ssd1306, config, SSD1306_WIDGET_LABEL);
+    if (ret != ESP_OK)
+        return ret;
+
+    size_t length = 0;
+    ssd1306_widget_append(widget->text, sizeof(widget->text), &length, text);
+    ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_widget_value(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, const char *prefix, const char *suffix, int32_t value)
+{
+    esp_err_t ret = ssd1306_widget_init(widget, i2c_ssd1306, config, SSD1306_WIDGET_VALUE);
+    if (ret != ESP_OK)
+        return ret;
+
+    widget->prefix = prefix;
+    widget->suffix = suffix;
+    widget->value = value;
+    ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_widget_icon(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, const ssd1306_sprite_t *sprite)
+{
+    esp_err_t ret = ssd1306_widget_init(widget, i2c_ssd1306, config, SSD1306_WIDGET_ICON);
+    if (ret != ESP_OK)
+        return ret;
+    if (!ssd1306_widget_sprite_fits(widget, sprite))
+        return ESP_ERR_INVALID_ARG;
+
+    widget->sprite = sprite;
+    ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_widget_bar(i2c_ssd1306_widget_t *widget, i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_widget_config_t *config, int32_t min, int32_t max, int32_t value)
+{
+    esp_err_t ret = ssd1306_widget_init(widget, i2c_ssd1306, config, SSD1306_WIDGET_BAR);
+    if (ret != ESP_OK)
+        return ret;
+    if (config->width < 5 || config->height < 5 || min >= max)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid bar: %dx%d box (min 5x5), range %ld..%ld", config->width, config->height, (long)min, (long)max);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    widget->min = min;
+    widget->max = max;
+    widget->value = value;
+    ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_widget_set_text(i2c_ssd1306_widget_t *widget, const char *text)
+{
+    if (!widget || widget->type != SSD1306_WIDGET_LABEL)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid widget: only labels have a text");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    char copy[SSD1306_WIDGET_TEXT_MAX];
+    size_t length = 0;
+    ssd1306_widget_append(copy, sizeof(copy), &length, text);
+    if (strcmp(copy, widget->text) == 0)
+        return ESP_OK;
+
+    memcpy(widget->text, copy, length + 1);
+    ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_widget_set_value(i2c_ssd1306_widget_t *widget, int32_t value)
+{
+    if (!widget || (widget->type != SSD1306_WIDGET_VALUE && widget->type != SSD1306_WIDGET_BAR))
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid widget: only values and bars have a value");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (value == widget->value)
+        return ESP_OK;
+
+    /* A bar only changes when its fill moves by a whole column. */
+    bool changed = (widget->type == SSD1306_WIDGET_VALUE) || ssd1306_widget_bar_fill(widget, value) != ssd1306_widget_bar_fill(widget, widget->value);
+    widget->value = value;
+    if (changed)
+        ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_widget_set_sprite(i2c_ssd1306_widget_t *widget, const ssd1306_sprite_t *sprite)
+{
+    if (!widget || widget->type != SSD1306_WIDGET_ICON)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid widget: only icons have a sprite");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!ssd1306_widget_sprite_fits(widget, sprite))
+        return ESP_ERR_INVALID_ARG;
+    if (sprite == widget->sprite)
+        return ESP_OK;
+
+    widget->sprite = sprite;
+    ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_ssd1306_widget_redraw(i2c_ssd1306_widget_t *widget)
+{
+    if (!widget || !widget->i2c_ssd1306)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid widget: not initialized");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ssd1306_widget_render(widget);
+
+    return ESP_OK;
+}
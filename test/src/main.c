@@ -3,6 +3,9 @@
 #include <ssd1306.h>
 #include <i2c_scanner.h>
 #include <driver/gpio.h>
+#ifdef CONFIG_SSD1306_SCL_CALIBRATION
+#include <nvs_flash.h>
+#endif
 
 static const char *TAG = "MAIN";
 
@@ -33,20 +36,28 @@ void my_print(const char *str)
     printf("%s", str);
 }
 
-void update_display(int count)
+static i2c_ssd1306_widget_t title;
+static i2c_ssd1306_widget_t subtitle;
+static i2c_ssd1306_widget_t count_value;
+
+void create_widgets(void)
 {
+    i2c_ssd1306_handle_t *display = get_ssd1306_handle();
+    i2c_ssd1306_widget_config_t title_config = {.x = 20, .y = 0, .width = 64, .height = 8};
+    i2c_ssd1306_widget_config_t subtitle_config = {.x = 8, .y = 10, .width = 104, .height = 8};
+    // The counter is centered over the full width, so its box spans the whole line
+    i2c_ssd1306_widget_config_t count_config = {.x = 0, .y = 22, .width = 128, .height = 8, .align = SSD1306_ALIGN_CENTER};
+
     ssd1306_buffer_clear();
-    ssd1306_print_str(20, 0, "ESP32-S3", false);
-    ssd1306_print_str(8, 10, "Touch Counter", false);
-    
-    char counter_str[32];
-    sprintf(counter_str, "Count: %d", count);
-    
-    // Center text
-    uint8_t text_len = strlen(counter_str);
-    uint8_t text_x = (128 - text_len * 8) / 2;
-    ssd1306_print_str(text_x, 22, counter_str, false);
-    
+    i2c_ssd1306_widget_label(&title, display, &title_config, "ESP32-S3");
+    i2c_ssd1306_widget_label(&subtitle, display, &subtitle_config, "Touch Counter");
+    i2c_ssd1306_widget_value(&count_value, display, &count_config, "Count: ", NULL, counter);
+}
+
+void update_display(int count)
+{
+    // Redraws and queues only the counter's box, and nothing at all if the value did not change
+    i2c_ssd1306_widget_set_value(&count_value, count);
     ssd1306_display();
 }
 
@@ -56,8 +67,16 @@ void app_main(void)
     
     init_ttp223();
     
+#ifdef CONFIG_SSD1306_SCL_CALIBRATION
+    // The calibrated SCL rate is kept in NVS
+    if (nvs_flash_init() != ESP_OK)
+        ESP_LOGW(TAG, "NVS unavailable, the SCL rate is calibrated on every boot");
+#endif
+
     ESP_LOGI(TAG, "Initializing SSD1306...");
     init_ssd1306();
+    // Flush frames from a background task so the touch loop never waits on I2C
+    init_ssd1306_async();
     
     vTaskDelay(500 / portTICK_PERIOD_MS);
     
@@ -70,7 +89,8 @@ void app_main(void)
     ESP_LOGI(TAG, "=== Ready! Touch the sensor ===");
     
     // Initial display
-    update_display(counter);
+    create_widgets();
+    ssd1306_display();
     
     bool pState = false;
     uint32_t tmr = 0;
@@ -97,6 +117,8 @@ void app_main(void)
             tmr = 0; 
         }
         
+        // Re-present frames dropped while the previous one was still flushing
+        ssd1306_display();
         vTaskDelay(1);
     }
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <time.h>
+#include <unity.h>
+#include "i2c_mock_display.h"
+
+/*
+ * Host micro-benchmarks for the renderer and the modeled I2C cost of each flush path.
+ * Numbers are printed, not asserted: they are for comparing changes on one machine. Run the native_128x32
+ * environment for the geometry-specialized paths.
+ */
+
+#define ITERATIONS 20000
+
+static i2c_master_bus_handle_t i2c_master_bus;
+static i2c_ssd1306_handle_t i2c_ssd1306;
+
+/* Raw strips of the 64x64 logo asset. */
+static uint8_t logo[64 * 64 / 8] __attribute__((aligned(4)));
+
+static void decode_logo(void)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_decode_image(&ssd1306_logo, logo));
+}
+
+static void init_display(uint8_t height, ssd1306_addressing_t addressing)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_init_display(height, addressing, &i2c_master_bus, &i2c_ssd1306));
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+#define BENCH(name, op)                                                       \
+    do                                                                        \
+    {                                                                         \
+        uint64_t start = now_ns();                                            \
+        for (int i = 0; i < ITERATIONS; i++)                                  \
+        {                                                                     \
+            op;                                                               \
+            __asm__ volatile("" ::: "memory");                                \
+        }                                                                     \
+        printf("  %-28s %8.1f ns/op\n", name, (double)(now_ns() - start) / ITERATIONS); \
+    } while (0)
+
+void setUp(void)
+{
+    i2c_mock_reset_all();
+}
+
+void tearDown(void)
+{
+}
+
+static void test_bench_render(void)
+{
+    init_display(32, SSD1306_ADDRESSING_HORIZONTAL);
+    decode_logo();
+    const ssd1306_sprite_t logo_sprite = {.width = 64, .height = 32, .bitmap = logo, .mask = NULL};
+    const ssd1306_image_t logo_raw = {.width = 64, .height = 64, .encoding = SSD1306_IMAGE_RAW, .size = sizeof(logo), .data = logo};
+
+    printf("render, 128x32:\n");
+    BENCH("buffer_clear", i2c_ssd1306_buffer_clear(&i2c_ssd1306));
+    BENCH("buffer_fill", i2c_ssd1306_buffer_fill(&i2c_ssd1306));
+    BENCH("fill_pixel", i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, i & 127, i & 31, true));
+    BENCH("fill_space 100x20", i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 13, 112, 5, 24, true));
+    BENCH("text 16 chars, aligned", i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 8, "0123456789ABCDEF", false));
+    BENCH("text 16 chars, unaligned", i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 13, "0123456789ABCDEF", false));
+    BENCH("text_font 16px, 8 chars", i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 0, 5, "12:34:56", &ssd1306_font_16, false, SSD1306_ROP_COPY));
+    BENCH("image 64x32", i2c_ssd1306_buffer_image(&i2c_ssd1306, 32, 0, logo, 64, 32, false));
+    BENCH("image asset 64x64, raw, unaligned", i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 32, -3, &logo_raw, false));
+    BENCH("image asset 64x64, rle, unaligned", i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 32, -3, &ssd1306_logo, false));
+    BENCH("sprite 64x32, xor", i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 29, -3, &logo_sprite, SSD1306_ROP_XOR));
+    BENCH("line 128x32", i2c_ssd1306_buffer_line(&i2c_ssd1306, 0, 0, 127, 31, true));
+    BENCH("line 128x32 by fill_pixel", for (int x = 0; x < 128; x++) i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, x, x * 31 / 127, true));
+    BENCH("circle r=15", i2c_ssd1306_buffer_circle(&i2c_ssd1306, 64, 16, 15, true));
+    BENCH("fill_circle r=15", i2c_ssd1306_buffer_fill_circle(&i2c_ssd1306, 64, 16, 15, true));
+
+    /* A static screen of 12 commands, drawn by direct calls and by replaying a recorded display list. */
+    ssd1306_list_command_t commands[12];
+    ssd1306_list_t list;
+    i2c_ssd1306_list_init(&list, commands, 12);
+    i2c_ssd1306_list_clear(&list, false);
+    i2c_ssd1306_list_text(&list, 20, 0, "ESP32-S3", &ssd1306_font_8x8, false, SSD1306_ROP_OR);
+    i2c_ssd1306_list_text(&list, 8, 10, "Touch Counter", &ssd1306_font_8x8, false, SSD1306_ROP_OR);
+    i2c_ssd1306_list_rect(&list, 0, 20, 128, 12, true);
+    for (int16_t x = 8; x < 120; x += 14)
+        i2c_ssd1306_list_pixel(&list, x, 25, true);
+    BENCH("screen, 12 direct calls", {
+        i2c_ssd1306_buffer_clear(&i2c_ssd1306);
+        i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 20, 0, "ESP32-S3", &ssd1306_font_8x8, false, SSD1306_ROP_OR);
+        i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 8, 10, "Touch Counter", &ssd1306_font_8x8, false, SSD1306_ROP_OR);
+        i2c_ssd1306_buffer_round_rect(&i2c_ssd1306, 0, 20, 128, 12, 0, true);
+        for (int16_t x = 8; x < 120; x += 14)
+            i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, x, 25, true);
+    });
+    BENCH("screen, 12-command list", i2c_ssd1306_list_submit(&i2c_ssd1306, &list));
+    TEST_ASSERT_NOT_EQUAL(0, i2c_ssd1306.dirty.pages);
+    i2c_ssd1306_deinit(&i2c_ssd1306);
+}
+
+static void report_flush(const char *name, esp_err_t (*flush)(i2c_ssd1306_handle_t *))
+{
+    i2c_mock_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, flush(&i2c_ssd1306));
+    printf("  %-28s %4u transactions %5u bytes %8.2f ms\n", name, (unsigned)i2c_mock_transaction_count(),
+           (unsigned)i2c_mock_wire_bytes(), i2c_mock_bus_time_ns() / 1e6);
+}
+
+static void test_bench_flush(void)
+{
+    static const ssd1306_addressing_t modes[] = {SSD1306_ADDRESSING_PAGE, SSD1306_ADDRESSING_HORIZONTAL};
+    static const char *mode_names[] = {"page", "horizontal"};
+
+    for (int m = 0; m < 2; m++)
+    {
+        for (uint8_t height = 32; height <= 64; height += 32)
+        {
+            init_display(height, modes[m]);
+            printf("flush, 128x%u %s addressing, 400 kHz:\n", height, mode_names[m]);
+            report_flush("full frame", i2c_ssd1306_buffer_to_ram);
+
+            i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 0, 127, 22, 29, false);
+            i2c_ssd1306_buffer_text(&i2c_ssd1306, 28, 22, "Count: 42", false);
+            report_flush("dirty counter update", i2c_ssd1306_dirty_to_ram);
+            i2c_ssd1306_deinit(&i2c_ssd1306);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_render);
+    RUN_TEST(test_bench_flush);
+    return UNITY_END();
+}
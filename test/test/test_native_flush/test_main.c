@@ -0,0 +1,770 @@
+#include <stdio.h>
+#include <unity.h>
+#include <nvs_flash.h>
+#include "freertos/semphr.h"
+#include "i2c_mock_display.h"
+
+/*
+ * Flush-path tests: what reaches the modeled SSD1306 RAM, in how many transactions and bytes.
+ */
+
+static i2c_master_bus_handle_t i2c_master_bus;
+static i2c_ssd1306_handle_t i2c_ssd1306;
+
+static void init_display(uint8_t height, ssd1306_addressing_t addressing)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_init_display(height, addressing, &i2c_master_bus, &i2c_ssd1306));
+}
+
+static void assert_display_ram_matches(const i2c_ssd1306_handle_t *display, uint16_t device_address)
+{
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, i2c_mock_ram_mismatch(display, device_address), "Framebuffer offset that differs from the display RAM");
+}
+
+static void assert_ram_matches_framebuffer(void)
+{
+    assert_display_ram_matches(&i2c_ssd1306, 0x3C);
+}
+
+static void draw_pattern(void)
+{
+    for (uint16_t i = 0; i < i2c_ssd1306.width * i2c_ssd1306.total_pages; i++)
+    {
+        uint8_t x = i % i2c_ssd1306.width;
+        uint8_t y = (i / i2c_ssd1306.width) * 8 + (i % 8);
+        i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, x, y, true);
+    }
+}
+
+void setUp(void)
+{
+    i2c_mock_reset_all();
+}
+
+void tearDown(void)
+{
+    i2c_ssd1306_deinit(&i2c_ssd1306);
+}
+
+static void test_full_flush_page_addressing(void)
+{
+    init_display(64, SSD1306_ADDRESSING_PAGE);
+    draw_pattern();
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(16, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(8 * (5 + 130), i2c_mock_wire_bytes());
+    TEST_ASSERT_EQUAL(i2c_mock_wire_bytes(), i2c_ssd1306.flush_wire_bytes);
+    assert_ram_matches_framebuffer();
+}
+
+static void test_full_flush_horizontal_addressing(void)
+{
+    init_display(64, SSD1306_ADDRESSING_HORIZONTAL);
+    draw_pattern();
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(2, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(8 + 1 + 1 + 1024, i2c_mock_wire_bytes());
+    TEST_ASSERT_EQUAL(0x40, i2c_mock_get_transaction(1)->data[0]);
+    assert_ram_matches_framebuffer();
+}
+
+static void test_flush_is_zero_copy(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    draw_pattern();
+    i2c_ssd1306_segments_to_ram(&i2c_ssd1306, 1, 10, 20);
+
+    /* The byte borrowed for the control byte is restored. */
+    TEST_ASSERT_EQUAL_HEX8(0x40, i2c_ssd1306.framebuffer[-1]);
+    TEST_ASSERT_EQUAL_HEX8(1 << (128 + 9) % 8, i2c_ssd1306.framebuffer[128 + 9]);
+    TEST_ASSERT_EQUAL(12, i2c_mock_get_transaction(1)->size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(&i2c_ssd1306.framebuffer[128 + 10], &i2c_mock_get_transaction(1)->data[1], 11);
+}
+
+static void test_framebuffer_storage(void)
+{
+    static uint8_t framebuffer[SSD1306_FRAMEBUFFER_SIZE(128, 32)] __attribute__((aligned(4)));
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    i2c_ssd1306_config_t caller_config = {
+        .i2c_device_address = 0x3D,
+        .i2c_scl_speed_hz = 400000,
+        .width = 128,
+        .height = 32,
+        .wise = SSD1306_BOTTOM_TO_TOP,
+        .framebuffer = framebuffer};
+    static i2c_ssd1306_handle_t caller;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_init(i2c_master_bus, caller_config, &caller));
+    TEST_ASSERT_TRUE(caller.framebuffer == framebuffer + SSD1306_FRAMEBUFFER_HEADER);
+    i2c_ssd1306_deinit(&caller);
+
+    /* Without caller storage the embedded array must hold the geometry. */
+    static i2c_ssd1306_handle_t embedded;
+    i2c_ssd1306_config_t embedded_config = {
+        .i2c_device_address = 0x3D,
+        .i2c_scl_speed_hz = 400000,
+        .width = 128,
+        .height = 64,
+        .wise = SSD1306_BOTTOM_TO_TOP};
+    esp_err_t expected = (SSD1306_EMBEDDED_FRAMEBUFFER_SIZE >= SSD1306_FRAMEBUFFER_SIZE(128, 64)) ? ESP_OK : ESP_ERR_INVALID_ARG;
+    TEST_ASSERT_EQUAL(expected, i2c_ssd1306_init(i2c_master_bus, embedded_config, &embedded));
+    if (expected == ESP_OK)
+        i2c_ssd1306_deinit(&embedded);
+#ifdef SSD1306_FIXED_WIDTH
+    TEST_ASSERT_EQUAL(SSD1306_FRAMEBUFFER_SIZE(SSD1306_FIXED_WIDTH, SSD1306_FIXED_HEIGHT), SSD1306_EMBEDDED_FRAMEBUFFER_SIZE);
+#endif
+}
+
+static void test_dirty_flush_page_addressing(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(4 * (5 + 130), i2c_ssd1306.flush_wire_bytes);
+
+    i2c_mock_reset();
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 28, 22, "Count: 42", false);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(4, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(2 * (5 + 2 + 72), i2c_ssd1306.flush_wire_bytes);
+    assert_ram_matches_framebuffer();
+
+    i2c_mock_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(0, i2c_mock_transaction_count());
+}
+
+static void test_dirty_flush_horizontal_addressing(void)
+{
+    init_display(64, SSD1306_ADDRESSING_HORIZONTAL);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+
+    i2c_mock_reset();
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 8, "ab", false);
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 40, 20, "cd", false);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    /* Bounding window pages 1..3 x segments 0..55: one window command and one data run per page. */
+    TEST_ASSERT_EQUAL(4, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(8 + 3 * (2 + 56), i2c_ssd1306.flush_wire_bytes);
+    assert_ram_matches_framebuffer();
+}
+
+static void test_flush_error_keeps_pages_dirty(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    i2c_mock_inject_error(ESP_ERR_TIMEOUT, 1);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL_HEX8(0x0F, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL_HEX8(0x00, i2c_ssd1306.dirty.pages);
+    assert_ram_matches_framebuffer();
+}
+
+static void test_flush_telemetry(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    ssd1306_stats_t stats;
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_to_ram(&i2c_ssd1306));
+    uint32_t frame_us = i2c_mock_bus_time_ns() / 1000;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_stats_get(&i2c_ssd1306, &stats));
+    /* The dirty flush after the full one sends nothing and is not a frame. */
+    TEST_ASSERT_EQUAL(1, stats.frames);
+    TEST_ASSERT_EQUAL(8, stats.transactions);
+    TEST_ASSERT_EQUAL(i2c_mock_wire_bytes(), stats.bytes);
+    TEST_ASSERT_UINT32_WITHIN(1, frame_us, stats.worst_latency_us);
+    TEST_ASSERT_EQUAL(stats.worst_latency_us, i2c_ssd1306_stats_latency_percentile(&stats, 50));
+
+    /* A transfer that times out stalls for the whole I2C timeout and fails its frame. */
+    for (int i = 0; i < 98; i++)
+        i2c_ssd1306_buffer_to_ram(&i2c_ssd1306);
+    i2c_mock_inject_error(ESP_ERR_TIMEOUT, 1);
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, i2c_ssd1306_buffer_to_ram(&i2c_ssd1306));
+    i2c_ssd1306_stats_get(&i2c_ssd1306, &stats);
+    TEST_ASSERT_EQUAL(100, stats.frames);
+    TEST_ASSERT_EQUAL(1, stats.failed_frames);
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, stats.errors[0].code);
+    TEST_ASSERT_EQUAL(1, stats.errors[0].count);
+    TEST_ASSERT_EQUAL(0, stats.errors[1].count);
+    TEST_ASSERT_UINT32_WITHIN(1, I2C_SSD1306_TIMEOUT_MS * 1000, stats.worst_stall_us);
+    /* 99 frames share the bucket of 'frame_us', which is half an octave wide. */
+    uint32_t p50 = i2c_ssd1306_stats_latency_percentile(&stats, 50);
+    TEST_ASSERT_TRUE(p50 >= frame_us && p50 < frame_us * 3 / 2);
+    TEST_ASSERT_EQUAL(p50, i2c_ssd1306_stats_latency_percentile(&stats, 99));
+    TEST_ASSERT_EQUAL(stats.worst_latency_us, i2c_ssd1306_stats_latency_percentile(&stats, 100));
+    i2c_ssd1306_stats_dump(&i2c_ssd1306);
+
+    i2c_ssd1306_stats_reset(&i2c_ssd1306);
+    i2c_ssd1306_stats_get(&i2c_ssd1306, &stats);
+    TEST_ASSERT_EQUAL(0, stats.frames);
+    TEST_ASSERT_EQUAL(0, i2c_ssd1306_stats_latency_percentile(&stats, 50));
+}
+
+static void test_scl_calibration(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    nvs_flash_erase();
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_flash_init());
+    i2c_mock_set_max_scl_hz(800000);
+    draw_pattern();
+    i2c_ssd1306_scl_calibration_config_t calibration_config = I2C_SSD1306_SCL_CALIBRATION_CONFIG_DEFAULT();
+    uint32_t scl_speed_hz = 0;
+
+    /* 400 to 800 kHz pass, 900 kHz fails; one step of margin settles at 700 kHz. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, &scl_speed_hz));
+    TEST_ASSERT_EQUAL(700000, scl_speed_hz);
+    TEST_ASSERT_EQUAL(700000, i2c_ssd1306.i2c_scl_speed_hz);
+    size_t count = i2c_mock_transaction_count();
+    TEST_ASSERT_EQUAL(700000, i2c_mock_get_transaction(count - 1)->scl_speed_hz);
+    assert_ram_matches_framebuffer();
+
+    /* The next boot applies the stored rate after a single verification frame. */
+    nvs_handle_t nvs;
+    uint32_t stored_hz = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_open("ssd1306", NVS_READONLY, &nvs));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_u32(nvs, "scl_3c", &stored_hz));
+    nvs_close(nvs);
+    TEST_ASSERT_EQUAL(700000, stored_hz);
+    i2c_ssd1306_deinit(&i2c_ssd1306);
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, &scl_speed_hz));
+    TEST_ASSERT_EQUAL(700000, scl_speed_hz);
+    /* One page-addressed frame: a window and a data transaction per page. */
+    TEST_ASSERT_EQUAL(8, i2c_mock_transaction_count());
+
+    /* A panel that fails at the start rate keeps the rate it was initialized with. */
+    calibration_config.use_stored = false;
+    i2c_ssd1306_deinit(&i2c_ssd1306);
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    i2c_mock_set_max_scl_hz(300000);
+    TEST_ASSERT_EQUAL(ESP_FAIL, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, &scl_speed_hz));
+    TEST_ASSERT_EQUAL(400000, i2c_ssd1306.i2c_scl_speed_hz);
+
+    /* A device that can not be added again, not even at its old rate, is added from scratch by the restore. */
+    i2c_mock_set_max_scl_hz(800000);
+    calibration_config.start_hz = 500000;
+    i2c_mock_fail_add_device(2);
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, &scl_speed_hz));
+    TEST_ASSERT_NOT_NULL(i2c_ssd1306.i2c_master_dev);
+    TEST_ASSERT_EQUAL(400000, i2c_ssd1306.i2c_scl_speed_hz);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(400000, i2c_mock_get_transaction(i2c_mock_transaction_count() - 1)->scl_speed_hz);
+    assert_ram_matches_framebuffer();
+
+    /* When the restore fails too the handle stays empty: transactions are refused, and the next calibration adds it. */
+    i2c_mock_fail_add_device(4);
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, &scl_speed_hz));
+    TEST_ASSERT_NULL(i2c_ssd1306.i2c_master_dev);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_buffer_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, &scl_speed_hz));
+    TEST_ASSERT_NOT_NULL(i2c_ssd1306.i2c_master_dev);
+    i2c_mock_fail_add_device(4);
+    calibration_config.start_hz = 600000;
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, &scl_speed_hz));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_deinit(&i2c_ssd1306));
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+
+    calibration_config.step_hz = 0;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_scl_calibrate(i2c_master_bus, &i2c_ssd1306, &calibration_config, NULL));
+    nvs_flash_erase();
+}
+
+static void test_gray_subframes(void)
+{
+    init_display(32, SSD1306_ADDRESSING_HORIZONTAL);
+    i2c_ssd1306_gray_config_t gray_config = I2C_SSD1306_GRAY_CONFIG_DEFAULT();
+    gray_config.subframe_hz = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_start(&i2c_ssd1306, &gray_config));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_gray_start(&i2c_ssd1306, &gray_config));
+    i2c_ssd1306_async_config_t async_config = I2C_SSD1306_ASYNC_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_async_start(&i2c_ssd1306, &async_config));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_gray_clear(&i2c_ssd1306, SSD1306_GRAY_LEVELS));
+
+    /* A bar of every level, and text imported at level 2 over a level 1 background. */
+    for (uint8_t level = 0; level < SSD1306_GRAY_LEVELS; level++)
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_fill_rect(&i2c_ssd1306, level * 8, -4, 8, 40, level));
+    i2c_ssd1306_gray_fill_rect(&i2c_ssd1306, 64, 16, 64, 16, 1);
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 64, 16, "AB", false);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_import(&i2c_ssd1306, 2));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_present(&i2c_ssd1306));
+
+    /* Level L is lit in subframes 0..L-1 of every cycle. */
+    const i2c_mock_ssd1306_t *model = i2c_mock_ssd1306(0x3C);
+    for (uint8_t subframe = 0; subframe < 2 * SSD1306_GRAY_SUBFRAMES; subframe++)
+    {
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_step(&i2c_ssd1306));
+        for (uint8_t level = 0; level < SSD1306_GRAY_LEVELS; level++)
+        {
+            uint8_t expected = (level > subframe % SSD1306_GRAY_SUBFRAMES) ? 0xFF : 0x00;
+            TEST_ASSERT_EQUAL_HEX8(expected, model->ram[0][level * 8]);
+            TEST_ASSERT_EQUAL_HEX8(expected, model->ram[3][level * 8 + 7]);
+        }
+        for (uint8_t x = 64; x < 80; x++)
+        {
+            uint8_t text = i2c_ssd1306.framebuffer[2 * 128 + x];
+            uint8_t expected = (subframe % SSD1306_GRAY_SUBFRAMES == 0) ? 0xFF : (subframe % SSD1306_GRAY_SUBFRAMES == 1) ? text : 0x00;
+            TEST_ASSERT_EQUAL_HEX8(expected, model->ram[2][x]);
+        }
+    }
+
+    /* The virtual clock only runs while a subframe is on the bus, so the measured rate is the bus-limited one. */
+    ssd1306_gray_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_get_stats(&i2c_ssd1306, &stats));
+    uint32_t subframe_us = i2c_mock_bus_time_ns() / 1000 / (2 * SSD1306_GRAY_SUBFRAMES);
+    TEST_ASSERT_EQUAL(2 * SSD1306_GRAY_SUBFRAMES, stats.subframes);
+    TEST_ASSERT_EQUAL(0, stats.failed_subframes);
+    TEST_ASSERT_UINT32_WITHIN(1, subframe_us, stats.subframe_period_us);
+    TEST_ASSERT_UINT32_WITHIN(1, 1000000 / (subframe_us * SSD1306_GRAY_SUBFRAMES), stats.refresh_hz);
+    TEST_ASSERT_EQUAL(2 * SSD1306_GRAY_SUBFRAMES, i2c_ssd1306.stats.frames);
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_stop(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_gray_step(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_gray_pixel(&i2c_ssd1306, 0, 0, 1));
+}
+
+static void test_gray_timer(void)
+{
+    init_display(32, SSD1306_ADDRESSING_HORIZONTAL);
+    draw_pattern();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    i2c_ssd1306_gray_config_t gray_config = I2C_SSD1306_GRAY_CONFIG_DEFAULT();
+
+    /* A 512-byte frame takes about 12 ms at 400 kHz; faster timers would drop ticks and skew the levels. */
+    TEST_ASSERT_EQUAL(85, i2c_ssd1306_gray_max_subframe_hz(&i2c_ssd1306));
+    gray_config.subframe_hz = 86;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_gray_start(&i2c_ssd1306, &gray_config));
+    TEST_ASSERT_NULL(i2c_ssd1306.gray);
+    gray_config = (i2c_ssd1306_gray_config_t)I2C_SSD1306_GRAY_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_start(&i2c_ssd1306, &gray_config));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_gray_step(&i2c_ssd1306));
+    i2c_ssd1306_gray_fill_rect(&i2c_ssd1306, 0, 0, 128, 32, 2);
+    i2c_ssd1306_gray_present(&i2c_ssd1306);
+
+    /* At the default rate every tick finds the bus free, so no tick is dropped. */
+    i2c_mock_set_realtime(true);
+    vTaskDelay(pdMS_TO_TICKS(300));
+    ssd1306_gray_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_get_stats(&i2c_ssd1306, &stats));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_gray_stop(&i2c_ssd1306));
+    TEST_ASSERT_TRUE(stats.subframes >= 5);
+    TEST_ASSERT_EQUAL(0, stats.missed_ticks);
+    TEST_ASSERT_EQUAL(0, stats.failed_subframes);
+    TEST_ASSERT_TRUE(stats.worst_subframe_period_us >= stats.subframe_period_us);
+    TEST_ASSERT_NULL(i2c_ssd1306.gray);
+
+    /* The next flush replaces the last subframe with the 1bpp framebuffer. */
+    i2c_mock_set_realtime(false);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    assert_ram_matches_framebuffer();
+}
+
+/* The RAM page 'ram_page' of the model shows 'text' in the 8x8 font, and nothing after it. */
+static void assert_console_line(uint8_t ram_page, const char *text)
+{
+    uint8_t expected[128] = {0};
+    for (uint8_t i = 0; text[i] && i < 16; i++)
+    {
+        const ssd1306_glyph_t *glyph = ssd1306_font_glyph(&ssd1306_font_8x8, (uint8_t)text[i]);
+        memcpy(&expected[i * 8], &ssd1306_font_8x8.bitmaps[glyph->offset], glyph->width);
+    }
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, i2c_mock_ssd1306(0x3C)->ram[ram_page], 128);
+}
+
+static void test_console_scrolls_by_start_line(void)
+{
+    init_display(32, SSD1306_ADDRESSING_HORIZONTAL);
+    i2c_ssd1306_console_config_t console_config = I2C_SSD1306_CONSOLE_CONFIG_DEFAULT();
+    console_config.task_stack_size = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_start(&i2c_ssd1306, &console_config));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_console_start(&i2c_ssd1306, &console_config));
+    i2c_ssd1306_gray_config_t gray_config = I2C_SSD1306_GRAY_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_gray_start(&i2c_ssd1306, &gray_config));
+
+    /* The first write blanks the panel's four lines and sets the start line. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_printf(&i2c_ssd1306, "line %d\n", 0));
+    TEST_ASSERT_EQUAL(4 * 2 + 1, i2c_mock_transaction_count());
+    assert_console_line(0, "line 0");
+    TEST_ASSERT_EQUAL(0, i2c_mock_ssd1306(0x3C)->start_line);
+
+    /* From then on a line is its page and, once the panel is full, one start line command. */
+    char text[8];
+    for (int line = 1; line < 12; line++)
+    {
+        i2c_mock_reset();
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_printf(&i2c_ssd1306, "line %d\n", line));
+        TEST_ASSERT_EQUAL((line < 4) ? 2 : 3, i2c_mock_transaction_count());
+        TEST_ASSERT_EQUAL((line < 4) ? 7 + 129 + 2 : 7 + 129 + 2 + 2 + 1, i2c_mock_wire_bytes());
+        snprintf(text, sizeof(text), "line %d", line);
+        assert_console_line(line % 8, text);
+        TEST_ASSERT_EQUAL(((line < 4) ? 0 : (line - 3) % 8) * 8, i2c_mock_ssd1306(0x3C)->start_line);
+    }
+
+    /* Long lines wrap at the panel width; the last visible lines are still in the RAM pages of the ring. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_write(&i2c_ssd1306, "0123456789abcdefWRAP"));
+    assert_console_line(12 % 8, "0123456789abcdef");
+    assert_console_line(13 % 8, "WRAP");
+    assert_console_line(11 % 8, "line 11");
+    assert_console_line(10 % 8, "line 10");
+    TEST_ASSERT_EQUAL((10 % 8) * 8, i2c_mock_ssd1306(0x3C)->start_line);
+
+    /* A clear puts the cursor line at the top. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_clear(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_write(&i2c_ssd1306, "top"));
+    assert_console_line(14 % 8, "top");
+    assert_console_line(15 % 8, "");
+    TEST_ASSERT_EQUAL((14 % 8) * 8, i2c_mock_ssd1306(0x3C)->start_line);
+
+    ssd1306_console_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_get_stats(&i2c_ssd1306, &stats));
+    TEST_ASSERT_EQUAL(14, stats.lines);
+    TEST_ASSERT_EQUAL(0, stats.dropped_lines);
+    TEST_ASSERT_EQUAL(0, stats.failed_writes);
+
+    /* Stopping hands the display back at start line 0 with everything due for the next flush. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_stop(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(0, i2c_mock_ssd1306(0x3C)->start_line);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    assert_ram_matches_framebuffer();
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_console_write(&i2c_ssd1306, "x"));
+}
+
+static void test_console_backpressure(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    i2c_ssd1306_console_config_t console_config = I2C_SSD1306_CONSOLE_CONFIG_DEFAULT();
+    console_config.task_stack_size = 0;
+    console_config.policy = SSD1306_PRESENT_DROP_STALE;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_start(&i2c_ssd1306, &console_config));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_flush(&i2c_ssd1306, 0));
+
+    /* A busy bus fails the write, but the line stays pending and goes out with the next one. */
+    i2c_mock_inject_error(ESP_ERR_TIMEOUT, 1);
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, i2c_ssd1306_console_write(&i2c_ssd1306, "busy\n"));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_write(&i2c_ssd1306, "free\n"));
+    assert_console_line(0, "busy");
+    assert_console_line(1, "free");
+
+    /* Lines that scroll away while the bus is down are dropped rather than blocking the writer. */
+    i2c_mock_inject_error(ESP_ERR_TIMEOUT, 1000);
+    for (int line = 0; line < 6; line++)
+        TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, i2c_ssd1306_console_printf(&i2c_ssd1306, "lost %d\n", line));
+    i2c_mock_inject_error(ESP_OK, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_flush(&i2c_ssd1306, 0));
+    ssd1306_console_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_get_stats(&i2c_ssd1306, &stats));
+    TEST_ASSERT_EQUAL(2, stats.dropped_lines);
+    TEST_ASSERT_TRUE(stats.failed_writes >= 7);
+    for (int line = 2; line < 6; line++)
+    {
+        char text[8];
+        snprintf(text, sizeof(text), "lost %d", line);
+        assert_console_line((line + 2) % 8, text);
+    }
+    TEST_ASSERT_EQUAL(4 * 8, i2c_mock_ssd1306(0x3C)->start_line);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_stop(&i2c_ssd1306));
+}
+
+static void test_console_task(void)
+{
+    init_display(64, SSD1306_ADDRESSING_HORIZONTAL);
+    i2c_ssd1306_console_config_t console_config = I2C_SSD1306_CONSOLE_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_start(&i2c_ssd1306, &console_config));
+    i2c_ssd1306_async_config_t async_config = I2C_SSD1306_ASYNC_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_async_start(&i2c_ssd1306, &async_config));
+
+    /* With the bus in real time the writer outruns the task; the waiting policy still shows every line. */
+    i2c_mock_set_realtime(true);
+    for (int line = 0; line < 20; line++)
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_printf(&i2c_ssd1306, "task %d\n", line));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_flush(&i2c_ssd1306, 1000));
+
+    ssd1306_console_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_get_stats(&i2c_ssd1306, &stats));
+    TEST_ASSERT_EQUAL(19, stats.lines);
+    TEST_ASSERT_EQUAL(0, stats.dropped_lines);
+    for (int line = 12; line < 20; line++)
+    {
+        char text[8];
+        snprintf(text, sizeof(text), "task %d", line);
+        assert_console_line(line % 8, text);
+    }
+    TEST_ASSERT_EQUAL((12 % 8) * 8, i2c_mock_ssd1306(0x3C)->start_line);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_console_stop(&i2c_ssd1306));
+    TEST_ASSERT_NULL(i2c_ssd1306.console);
+}
+
+static int frames_done;
+
+static void on_frame_done(i2c_ssd1306_handle_t *handle, esp_err_t err, void *user_ctx)
+{
+    (void)handle;
+    (void)user_ctx;
+    if (err == ESP_OK)
+        frames_done++;
+}
+
+static void test_async_present(void)
+{
+    init_display(64, SSD1306_ADDRESSING_HORIZONTAL);
+    i2c_ssd1306_async_config_t async_config = I2C_SSD1306_ASYNC_CONFIG_DEFAULT();
+    async_config.policy = SSD1306_PRESENT_WAIT;
+    async_config.on_frame_done = on_frame_done;
+    frames_done = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_start(&i2c_ssd1306, &async_config));
+
+    draw_pattern();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 16, 40, "async", true);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_wait(&i2c_ssd1306, 1000));
+    TEST_ASSERT_EQUAL(2, frames_done);
+    assert_ram_matches_framebuffer();
+
+    /* Nothing dirty: presenting again neither wakes the task nor touches the bus. */
+    i2c_mock_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_wait(&i2c_ssd1306, 1000));
+    TEST_ASSERT_EQUAL(0, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_stop(&i2c_ssd1306));
+}
+
+static void test_scroll_horizontal(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    draw_pattern();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+
+    i2c_mock_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_horizontal(&i2c_ssd1306, SSD1306_SCROLL_LEFT, 1, 2, SSD1306_SCROLL_2_FRAMES));
+    const uint8_t scroll_cmd[] = {0x00, 0x2E, 0x27, 0x00, 0x01, 0x07, 0x02, 0x00, 0xFF, 0x2F};
+    TEST_ASSERT_EQUAL(1, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(sizeof(scroll_cmd), i2c_mock_get_transaction(0)->size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(scroll_cmd, i2c_mock_get_transaction(0)->data, sizeof(scroll_cmd));
+    TEST_ASSERT_TRUE(i2c_mock_ssd1306(0x3C)->scroll_active);
+
+    /* No RAM access while scrolling: the change stays dirty. */
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 24, "tick", false);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(1, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_scroll_step(&i2c_ssd1306, SSD1306_SCROLL_LEFT, 0, 0, 0, 127));
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_stop(&i2c_ssd1306));
+    TEST_ASSERT_FALSE(i2c_mock_ssd1306(0x3C)->scroll_active);
+    TEST_ASSERT_EQUAL_HEX8(0x0E, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    assert_ram_matches_framebuffer();
+}
+
+static void test_scroll_vertical(void)
+{
+    init_display(32, SSD1306_ADDRESSING_HORIZONTAL);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_scroll_area(&i2c_ssd1306, 8, 32));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_area(&i2c_ssd1306, 8, 24));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_scroll_vertical(&i2c_ssd1306, SSD1306_SCROLL_RIGHT, 4, 7, SSD1306_SCROLL_5_FRAMES, 24));
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_vertical(&i2c_ssd1306, SSD1306_SCROLL_RIGHT, 4, 7, SSD1306_SCROLL_5_FRAMES, 1));
+    const uint8_t scroll_cmd[] = {0x00, 0x2E, 0xA3, 0x08, 0x18, 0x29, 0x00, 0x04, 0x00, 0x07, 0x01, 0x2F};
+    TEST_ASSERT_EQUAL(sizeof(scroll_cmd), i2c_mock_get_transaction(0)->size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(scroll_cmd, i2c_mock_get_transaction(0)->data, sizeof(scroll_cmd));
+
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_stop(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL_HEX8(0x0F, i2c_ssd1306.dirty.pages);
+}
+
+static void test_scroll_step_keeps_framebuffer_consistent(void)
+{
+    init_display(32, SSD1306_ADDRESSING_PAGE);
+    draw_pattern();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_step(&i2c_ssd1306, SSD1306_SCROLL_RIGHT, 1, 2, 10, 50));
+    assert_ram_matches_framebuffer();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+
+    /* A marquee step resends only the entering column of every page. */
+    for (int step = 0; step < 3; step++)
+    {
+        i2c_mock_reset();
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_step(&i2c_ssd1306, SSD1306_SCROLL_LEFT, 0, 3, 0, 127));
+        i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, 127, step * 8, step & 1);
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+        TEST_ASSERT_EQUAL(4 * (5 + 3), i2c_ssd1306.flush_wire_bytes);
+        assert_ram_matches_framebuffer();
+    }
+}
+
+static void test_scroll_step_async(void)
+{
+    init_display(64, SSD1306_ADDRESSING_HORIZONTAL);
+    i2c_ssd1306_async_config_t async_config = I2C_SSD1306_ASYNC_CONFIG_DEFAULT();
+    async_config.policy = SSD1306_PRESENT_WAIT;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_start(&i2c_ssd1306, &async_config));
+    draw_pattern();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_wait(&i2c_ssd1306, 1000));
+
+    /* The front buffer scrolls with the display RAM, so a present never resends columns from before the step. */
+    for (int step = 0; step < 6; step++)
+    {
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_step(&i2c_ssd1306, (step & 2) ? SSD1306_SCROLL_RIGHT : SSD1306_SCROLL_LEFT, 1, 6, 8, 119));
+        i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, 119, 8 + step * 8, step & 1);
+        if (step == 3)
+            i2c_ssd1306_buffer_text(&i2c_ssd1306, 40, 24, "mq", true);
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_wait(&i2c_ssd1306, 1000));
+        assert_ram_matches_framebuffer();
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_async_stop(&i2c_ssd1306));
+}
+
+static void test_scheduler_round_robin(void)
+{
+    static i2c_ssd1306_handle_t second_ssd1306;
+    init_display(64, SSD1306_ADDRESSING_PAGE);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_init_display_at(0x3D, 128, 32, SSD1306_ADDRESSING_HORIZONTAL, &i2c_master_bus, &second_ssd1306));
+
+    ssd1306_scheduler_t *scheduler;
+    i2c_ssd1306_scheduler_config_t scheduler_config = I2C_SSD1306_SCHEDULER_CONFIG_DEFAULT();
+    scheduler_config.budget_bytes = 100;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_create(&scheduler_config, &scheduler));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_add(scheduler, &i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_add(scheduler, &second_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_scheduler_add(scheduler, &i2c_ssd1306));
+    i2c_ssd1306_async_config_t async_config = I2C_SSD1306_ASYNC_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_async_start(&i2c_ssd1306, &async_config));
+
+    /* A busy 128x64 frame and a small 128x32 one; one page window fits the budget per turn. */
+    draw_pattern();
+    i2c_ssd1306_buffer_text(&second_ssd1306, 0, 8, "idle", false);
+    i2c_mock_reset();
+    i2c_mock_set_realtime(true);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&second_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_wait(scheduler, 1000));
+    i2c_mock_set_realtime(false);
+
+    /* Turns alternate until the small frame is done, then the busy one takes the bus. */
+    TEST_ASSERT_EQUAL(2 * (8 + 4), i2c_mock_transaction_count());
+    for (size_t i = 0; i < 16; i++)
+    {
+        TEST_ASSERT_EQUAL_HEX16((i / 2) % 2 ? 0x3D : 0x3C, i2c_mock_get_transaction(i)->device_address);
+    }
+    assert_display_ram_matches(&i2c_ssd1306, 0x3C);
+    assert_display_ram_matches(&second_ssd1306, 0x3D);
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_remove(&second_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, i2c_ssd1306_scheduler_remove(&second_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_delete(scheduler));
+    TEST_ASSERT_NULL(i2c_ssd1306.scheduler);
+    i2c_ssd1306_deinit(&second_ssd1306);
+}
+
+static i2c_ssd1306_handle_t busy_ssd1306;
+static volatile bool busy_running;
+static SemaphoreHandle_t busy_done;
+
+/* Keeps the scheduler task busy with small frames of 'busy_ssd1306' until 'busy_running' is cleared. */
+static void busy_present_task(void *arg)
+{
+    (void)arg;
+    for (uint8_t x = 0; busy_running; x = (x + 1) % 128)
+    {
+        i2c_ssd1306_buffer_fill_pixel(&busy_ssd1306, x, 4, true);
+        i2c_ssd1306_present(&busy_ssd1306);
+        vTaskDelay(1);
+    }
+    xSemaphoreGive(busy_done);
+    vTaskDelete(NULL);
+}
+
+static void test_scroll_step_scheduled(void)
+{
+    init_display(64, SSD1306_ADDRESSING_HORIZONTAL);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_init_display_at(0x3D, 128, 32, SSD1306_ADDRESSING_HORIZONTAL, &i2c_master_bus, &busy_ssd1306));
+    ssd1306_scheduler_t *scheduler;
+    i2c_ssd1306_scheduler_config_t scheduler_config = I2C_SSD1306_SCHEDULER_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_create(&scheduler_config, &scheduler));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_add(scheduler, &i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_add(scheduler, &busy_ssd1306));
+    draw_pattern();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_wait(scheduler, 1000));
+
+    /* Steps race the turns of the other display; the slot lock of a stepping display must not block them. */
+    i2c_mock_set_realtime(true);
+    busy_running = true;
+    busy_done = xSemaphoreCreateBinary();
+    TaskHandle_t busy_task;
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreatePinnedToCore(busy_present_task, "busy", 4096, NULL, 5, &busy_task, 0));
+    for (int step = 0; step < 100; step++)
+    {
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scroll_step(&i2c_ssd1306, SSD1306_SCROLL_LEFT, 0, 7, 0, 127));
+        i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, 127, step % 64, step & 1);
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    }
+    busy_running = false;
+    TEST_ASSERT_TRUE(xSemaphoreTake(busy_done, 1000));
+    vSemaphoreDelete(busy_done);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_wait(scheduler, 1000));
+    i2c_mock_set_realtime(false);
+    assert_display_ram_matches(&i2c_ssd1306, 0x3C);
+    assert_display_ram_matches(&busy_ssd1306, 0x3D);
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_delete(scheduler));
+    i2c_ssd1306_deinit(&busy_ssd1306);
+}
+
+static void test_scheduler_retries_after_error(void)
+{
+    init_display(32, SSD1306_ADDRESSING_HORIZONTAL);
+    ssd1306_scheduler_t *scheduler;
+    i2c_ssd1306_scheduler_config_t scheduler_config = I2C_SSD1306_SCHEDULER_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_create(&scheduler_config, &scheduler));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_add(scheduler, &i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_wait(scheduler, 1000));
+
+    draw_pattern();
+    i2c_mock_inject_error(ESP_ERR_TIMEOUT, 1);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, i2c_ssd1306_scheduler_wait(scheduler, 1000));
+
+    /* Nothing new is dirty, but the failed windows are still due. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_present(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_wait(scheduler, 1000));
+    assert_ram_matches_framebuffer();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_scheduler_delete(scheduler));
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_full_flush_page_addressing);
+    RUN_TEST(test_full_flush_horizontal_addressing);
+    RUN_TEST(test_flush_is_zero_copy);
+    RUN_TEST(test_framebuffer_storage);
+    RUN_TEST(test_dirty_flush_page_addressing);
+    RUN_TEST(test_dirty_flush_horizontal_addressing);
+    RUN_TEST(test_flush_error_keeps_pages_dirty);
+    RUN_TEST(test_flush_telemetry);
+    RUN_TEST(test_scl_calibration);
+    RUN_TEST(test_gray_subframes);
+    RUN_TEST(test_gray_timer);
+    RUN_TEST(test_console_scrolls_by_start_line);
+    RUN_TEST(test_console_backpressure);
+    RUN_TEST(test_console_task);
+    RUN_TEST(test_async_present);
+    RUN_TEST(test_scroll_horizontal);
+    RUN_TEST(test_scroll_vertical);
+    RUN_TEST(test_scroll_step_keeps_framebuffer_consistent);
+    RUN_TEST(test_scroll_step_async);
+    RUN_TEST(test_scheduler_round_robin);
+    RUN_TEST(test_scheduler_retries_after_error);
+    RUN_TEST(test_scroll_step_scheduled);
+    return UNITY_END();
+}
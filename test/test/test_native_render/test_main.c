@@ -0,0 +1,388 @@
+#include <unity.h>
+#include "i2c_mock_display.h"
+
+#define FRAME_SIZE (128 * 32 / 8)
+
+#ifndef SSD1306_GOLDEN_UPDATE
+#include "golden_frames.h"
+#endif
+
+/*
+ * Golden-frame tests for the SSD1306 renderer on the 128x32 panel of the touch counter.
+ * Build with -D SSD1306_GOLDEN_UPDATE to print the frames as C arrays instead of comparing them.
+ */
+
+static i2c_master_bus_handle_t i2c_master_bus;
+static i2c_ssd1306_handle_t i2c_ssd1306;
+
+/* Raw strips of the 64x64 logo asset. */
+static uint8_t logo[64 * 64 / 8] __attribute__((aligned(4)));
+
+static void decode_logo(void)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_decode_image(&ssd1306_logo, logo));
+}
+
+#ifdef SSD1306_GOLDEN_UPDATE
+static void print_frame(const char *name)
+{
+    printf("static const uint8_t %s[FRAME_SIZE] = {\n", name);
+    for (int i = 0; i < FRAME_SIZE; i++)
+        printf("%s0x%02X%s", (i % 16 == 0) ? "    " : "", i2c_ssd1306.framebuffer[i], (i == FRAME_SIZE - 1) ? "};\n\n" : (i % 16 == 15) ? ",\n" : ", ");
+}
+#define ASSERT_FRAME(golden) print_frame(#golden)
+#else
+#define ASSERT_FRAME(golden) TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE(golden, i2c_ssd1306.framebuffer, FRAME_SIZE, #golden)
+#endif
+
+void setUp(void)
+{
+    i2c_mock_reset_all();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_init_display(32, SSD1306_ADDRESSING_PAGE, &i2c_master_bus, &i2c_ssd1306));
+    decode_logo();
+}
+
+void tearDown(void)
+{
+    i2c_ssd1306_deinit(&i2c_ssd1306);
+}
+
+static void test_text(void)
+{
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 20, 0, "ESP32-S3", false);
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 8, 10, "Touch Counter", false);
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 28, 22, "Count: 42", false);
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 120, 27, "<>", true);
+    ASSERT_FRAME(golden_text);
+}
+
+static void test_text_copy(void)
+{
+    i2c_ssd1306_buffer_fill(&i2c_ssd1306);
+    i2c_ssd1306_buffer_text_rop(&i2c_ssd1306, 4, 3, "copy", false, SSD1306_ROP_COPY);
+    i2c_ssd1306_buffer_text_rop(&i2c_ssd1306, 60, 16, "mode", true, SSD1306_ROP_COPY);
+    ASSERT_FRAME(golden_text_copy);
+}
+
+static void test_text_font(void)
+{
+    i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 0, 0, "21\u00B0C", &ssd1306_font_24, false, SSD1306_ROP_OR);
+    i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 72, 3, "Wi-Fi", &ssd1306_font_16, false, SSD1306_ROP_OR);
+    i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 74, 22, "\u00C5ll ok", &ssd1306_font_8, true, SSD1306_ROP_OR);
+    ASSERT_FRAME(golden_text_font);
+}
+
+static void test_text_font_copy(void)
+{
+    i2c_ssd1306_buffer_fill(&i2c_ssd1306);
+    i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 6, 5, "jig", &ssd1306_font_16, false, SSD1306_ROP_COPY);
+    i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 100, 20, "end", &ssd1306_font_16, true, SSD1306_ROP_COPY);
+    ASSERT_FRAME(golden_text_font_copy);
+}
+
+static void test_text_font_width(void)
+{
+    /* The 8x8 font keeps the cells of i2c_ssd1306_buffer_text(); the degree sign is one glyph of two bytes. */
+    TEST_ASSERT_EQUAL(9 * 8, ssd1306_font_text_width(&ssd1306_font_8x8, "Count: 42"));
+    TEST_ASSERT_EQUAL(ssd1306_font_text_width(&ssd1306_font_16, "5") + ssd1306_font_text_width(&ssd1306_font_16, "\u00B0"),
+                      ssd1306_font_text_width(&ssd1306_font_16, "5\u00B0"));
+    TEST_ASSERT_LESS_THAN(ssd1306_font_text_width(&ssd1306_font_8, "W"), ssd1306_font_text_width(&ssd1306_font_8, "i"));
+
+    i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+    uint16_t width = ssd1306_font_text_width(&ssd1306_font_16, "Wi-Fi");
+    i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 10, 4, "Wi-Fi", &ssd1306_font_16, false, SSD1306_ROP_OR);
+    TEST_ASSERT_EQUAL_HEX8(0x07, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(10, i2c_ssd1306.dirty.start[0]);
+    TEST_ASSERT_EQUAL(10 + width - 1, i2c_ssd1306.dirty.end[2]);
+}
+
+static void test_image(void)
+{
+    i2c_ssd1306_buffer_image(&i2c_ssd1306, 32, 0, logo, 64, 32, false);
+    ASSERT_FRAME(golden_logo);
+}
+
+static void test_image_unaligned(void)
+{
+    i2c_ssd1306_buffer_image(&i2c_ssd1306, 100, 5, logo, 64, 32, true);
+    ASSERT_FRAME(golden_image_unaligned);
+}
+
+static void test_image_asset(void)
+{
+    /* An asset replaces its whole box, like a COPY sprite of the decoded strips, wherever it is clipped. */
+    static const int16_t positions[][2] = {{32, 0}, {100, 5}, {-7, -13}, {40, -30}, {3, 27}, {-63, 31}};
+    static uint8_t inverted[sizeof(logo)] __attribute__((aligned(4)));
+    for (size_t i = 0; i < sizeof(logo); i++)
+        inverted[i] = ~logo[i];
+    const ssd1306_sprite_t sprites[2] = {
+        {.width = 64, .height = 64, .bitmap = logo, .mask = NULL},
+        {.width = 64, .height = 64, .bitmap = inverted, .mask = NULL}};
+    uint8_t expected[FRAME_SIZE];
+    ssd1306_dirty_t expected_dirty;
+
+    for (size_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++)
+    {
+        for (int invert = 0; invert < 2; invert++)
+        {
+            i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 12, "background pixels", false);
+            i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+            i2c_ssd1306_buffer_sprite(&i2c_ssd1306, positions[i][0], positions[i][1], &sprites[invert], SSD1306_ROP_COPY);
+            memcpy(expected, i2c_ssd1306.framebuffer, FRAME_SIZE);
+            expected_dirty = i2c_ssd1306.dirty;
+
+            i2c_ssd1306_buffer_clear(&i2c_ssd1306);
+            i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 12, "background pixels", false);
+            i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+            TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, positions[i][0], positions[i][1], &ssd1306_logo, invert));
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, i2c_ssd1306.framebuffer, FRAME_SIZE);
+            TEST_ASSERT_EQUAL_MEMORY(&expected_dirty, &i2c_ssd1306.dirty, sizeof(ssd1306_dirty_t));
+            i2c_ssd1306_buffer_clear(&i2c_ssd1306);
+        }
+    }
+}
+
+static void test_image_asset_encodings(void)
+{
+    /* 3x10: a lit strip, then two rows of a partial strip; the six rows below the image are not part of it. */
+    static const uint8_t raw_data[] = {0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03};
+    static const uint8_t rle_data[] = {0x80, 0xFF, 0x80, 0x03};
+    static const uint8_t rle_literal_data[] = {0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03};
+    const ssd1306_image_t images[] = {
+        {.width = 3, .height = 10, .encoding = SSD1306_IMAGE_RAW, .size = sizeof(raw_data), .data = raw_data},
+        {.width = 3, .height = 10, .encoding = SSD1306_IMAGE_RLE, .size = sizeof(rle_data), .data = rle_data},
+        {.width = 3, .height = 10, .encoding = SSD1306_IMAGE_RLE, .size = sizeof(rle_literal_data), .data = rle_literal_data}};
+
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++)
+    {
+        i2c_ssd1306_buffer_fill(&i2c_ssd1306);
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 0, 3, &images[i], true));
+        /* Inverted, the box of rows 3..12 is cleared and the rows around it are kept. */
+        for (int x = 0; x < 3; x++)
+        {
+            TEST_ASSERT_EQUAL_HEX8(0x07, i2c_ssd1306.framebuffer[x]);
+            TEST_ASSERT_EQUAL_HEX8(0xE0, i2c_ssd1306.framebuffer[128 + x]);
+        }
+        TEST_ASSERT_EQUAL_HEX8(0xFF, i2c_ssd1306.framebuffer[3]);
+    }
+
+    /* Data that ends before the visible strips are complete keeps what was decoded and reports it. */
+    const ssd1306_image_t truncated_rle = {.width = 3, .height = 10, .encoding = SSD1306_IMAGE_RLE, .size = 2, .data = rle_data};
+    const ssd1306_image_t cut_packet = {.width = 3, .height = 10, .encoding = SSD1306_IMAGE_RLE, .size = 3, .data = rle_data};
+    const ssd1306_image_t truncated_raw = {.width = 3, .height = 10, .encoding = SSD1306_IMAGE_RAW, .size = 4, .data = raw_data};
+    i2c_ssd1306_buffer_clear(&i2c_ssd1306);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 0, 0, &truncated_rle, false));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, i2c_ssd1306.framebuffer[2]);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 0, 0, &cut_packet, false));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 0, 0, &truncated_raw, false));
+    /* Strips below the panel are never decoded, so their data is not needed. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 0, 24, &truncated_rle, false));
+
+    const ssd1306_image_t unknown = {.width = 3, .height = 10, .encoding = SSD1306_IMAGE_RLE + 1, .size = 4, .data = rle_data};
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 0, 0, &unknown, false));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_image_asset(&i2c_ssd1306, 0, 0, NULL, false));
+}
+
+/* 12x10 bell icon; its mask covers the outline and the inside, so COPY blanks the inside of the bell. */
+static const uint8_t bell_bitmap[] = {
+    0xC0, 0xA0, 0x9C, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x9C, 0xA0, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00};
+static const uint8_t bell_mask[] = {
+    0xC0, 0xE0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xE0, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00};
+static const ssd1306_sprite_t bell = {.width = 12, .height = 10, .bitmap = bell_bitmap, .mask = bell_mask};
+static const ssd1306_sprite_t bell_box = {.width = 12, .height = 10, .bitmap = bell_bitmap, .mask = NULL};
+
+static void test_sprite(void)
+{
+    i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 0, 63, 0, 31, true);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, -4, -3, &bell, SSD1306_ROP_COPY);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 20, 13, &bell, SSD1306_ROP_AND_NOT);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 40, 3, &bell_box, SSD1306_ROP_COPY);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 58, 20, &bell, SSD1306_ROP_XOR);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 80, 5, &bell, SSD1306_ROP_OR);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 122, 27, &bell_box, SSD1306_ROP_OR);
+    ASSERT_FRAME(golden_sprite);
+}
+
+static void test_sprite_xor_restores(void)
+{
+    uint8_t before[FRAME_SIZE];
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 4, "XOR sprite test!", false);
+    memcpy(before, i2c_ssd1306.framebuffer, FRAME_SIZE);
+    i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+
+    static const int16_t positions[][2] = {{-11, -9}, {-5, 6}, {3, 0}, {61, 13}, {117, 22}, {127, 31}};
+    for (size_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++)
+        i2c_ssd1306_buffer_sprite(&i2c_ssd1306, positions[i][0], positions[i][1], &bell, SSD1306_ROP_XOR);
+    for (size_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++)
+        i2c_ssd1306_buffer_sprite(&i2c_ssd1306, positions[i][0], positions[i][1], &bell, SSD1306_ROP_XOR);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(before, i2c_ssd1306.framebuffer, FRAME_SIZE);
+
+    /* The dirty window is the clipped sprite box; a sprite entirely outside of the panel marks nothing. */
+    i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_sprite(&i2c_ssd1306, -12, 0, &bell, SSD1306_ROP_OR));
+    TEST_ASSERT_EQUAL_HEX8(0x00, i2c_ssd1306.dirty.pages);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 120, -4, &bell, SSD1306_ROP_OR);
+    TEST_ASSERT_EQUAL_HEX8(0x01, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(120, i2c_ssd1306.dirty.start[0]);
+    TEST_ASSERT_EQUAL(127, i2c_ssd1306.dirty.end[0]);
+}
+
+static void test_fill_space(void)
+{
+    i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 0, 127, 0, 0, true);
+    i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 0, 127, 31, 31, true);
+    i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 10, 40, 3, 28, true);
+    i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 15, 35, 6, 20, false);
+    i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 90, 90, 9, 14, true);
+    i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, 127, 16, true);
+    ASSERT_FRAME(golden_fill_space);
+}
+
+static void test_shapes(void)
+{
+    static const ssd1306_point_t arrow[] = {{100, 4}, {120, 15}, {100, 26}, {106, 15}};
+
+    i2c_ssd1306_buffer_line(&i2c_ssd1306, 0, 0, 30, 9, true);
+    i2c_ssd1306_buffer_line(&i2c_ssd1306, 2, 31, 9, 6, true);
+    i2c_ssd1306_buffer_hline(&i2c_ssd1306, 12, 28, 20, true);
+    i2c_ssd1306_buffer_vline(&i2c_ssd1306, 34, 12, 17, true);
+    i2c_ssd1306_buffer_circle(&i2c_ssd1306, 50, 15, 11, true);
+    i2c_ssd1306_buffer_fill_circle(&i2c_ssd1306, 50, 15, 4, true);
+    i2c_ssd1306_buffer_arc(&i2c_ssd1306, 80, 20, 14, 180, 315, true);
+    i2c_ssd1306_buffer_round_rect(&i2c_ssd1306, 66, 22, 28, 10, 4, true);
+    i2c_ssd1306_buffer_fill_round_rect(&i2c_ssd1306, 70, 25, 8, 5, 2, true);
+    i2c_ssd1306_buffer_fill_polygon(&i2c_ssd1306, arrow, 4, true);
+    i2c_ssd1306_buffer_line(&i2c_ssd1306, 100, 15, 127, 15, false);
+    ASSERT_FRAME(golden_shapes);
+}
+
+static void test_shapes_clipped(void)
+{
+    static const ssd1306_point_t triangle[] = {{-20, 10}, {10, -5}, {15, 40}};
+
+    i2c_ssd1306_buffer_fill_polygon(&i2c_ssd1306, triangle, 3, true);
+    i2c_ssd1306_buffer_circle(&i2c_ssd1306, 127, 31, 20, true);
+    i2c_ssd1306_buffer_line(&i2c_ssd1306, -100, 40, 300, -10, true);
+    i2c_ssd1306_buffer_fill_round_rect(&i2c_ssd1306, 40, -6, 30, 12, 5, true);
+    i2c_ssd1306_buffer_fill_circle(&i2c_ssd1306, 60, 20, 6, false);
+    ASSERT_FRAME(golden_shapes_clipped);
+
+    /* Shapes entirely off the panel draw nothing and leave the dirty window alone. */
+    i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_line(&i2c_ssd1306, -50, -5, -1, -40, true));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_buffer_fill_circle(&i2c_ssd1306, 200, 10, 30, true));
+    TEST_ASSERT_EQUAL_HEX8(0x00, i2c_ssd1306.dirty.pages);
+
+    i2c_ssd1306_buffer_hline(&i2c_ssd1306, -10, 17, 40, true);
+    TEST_ASSERT_EQUAL_HEX8(0x04, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(0, i2c_ssd1306.dirty.start[2]);
+    TEST_ASSERT_EQUAL(29, i2c_ssd1306.dirty.end[2]);
+}
+
+static void test_display_list(void)
+{
+    ssd1306_list_command_t commands[12];
+    ssd1306_list_t list;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_list_init(&list, commands, 12));
+    i2c_ssd1306_list_clear(&list, false);
+    i2c_ssd1306_list_text(&list, 20, 0, "ESP32-S3", &ssd1306_font_8x8, false, SSD1306_ROP_OR);
+    i2c_ssd1306_list_text(&list, 200, 0, "skipped", &ssd1306_font_8x8, false, SSD1306_ROP_OR);
+    i2c_ssd1306_list_fill_rect(&list, -4, 10, 20, 30, true);
+    i2c_ssd1306_list_rect(&list, 30, 12, 40, 18, true);
+    i2c_ssd1306_list_line(&list, 72, 31, 100, 10, true);
+    i2c_ssd1306_list_circle(&list, 110, 20, 9, true);
+    i2c_ssd1306_list_fill_circle(&list, 110, 20, 4, true);
+    i2c_ssd1306_list_pixel(&list, 127, 31, true);
+    i2c_ssd1306_list_pixel(&list, 128, 0, true);
+    i2c_ssd1306_list_sprite(&list, 40, 15, &bell, SSD1306_ROP_XOR);
+
+    /* The same screen drawn with the buffer functions. */
+    uint8_t expected[FRAME_SIZE];
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 20, 0, "ESP32-S3", false);
+    i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 0, 15, 10, 31, true);
+    i2c_ssd1306_buffer_round_rect(&i2c_ssd1306, 30, 12, 40, 18, 0, true);
+    i2c_ssd1306_buffer_line(&i2c_ssd1306, 72, 31, 100, 10, true);
+    i2c_ssd1306_buffer_circle(&i2c_ssd1306, 110, 20, 9, true);
+    i2c_ssd1306_buffer_fill_circle(&i2c_ssd1306, 110, 20, 4, true);
+    i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, 127, 31, true);
+    i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 40, 15, &bell, SSD1306_ROP_XOR);
+    memcpy(expected, i2c_ssd1306.framebuffer, FRAME_SIZE);
+
+    /* Replays draw the same frame, whatever the buffer held. */
+    for (int replay = 0; replay < 2; replay++)
+    {
+        i2c_ssd1306_buffer_fill(&i2c_ssd1306);
+        i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+        TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_list_submit(&i2c_ssd1306, &list));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, i2c_ssd1306.framebuffer, FRAME_SIZE);
+        TEST_ASSERT_EQUAL_HEX8(0x0F, i2c_ssd1306.dirty.pages);
+    }
+
+    /* Full lists and invalid commands are refused before anything is drawn. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_list_text(&list, 0, 0, NULL, &ssd1306_font_8x8, false, SSD1306_ROP_OR));
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, i2c_ssd1306_list_clear(&list, true));
+    i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, i2c_ssd1306_list_submit(&i2c_ssd1306, &list));
+    i2c_ssd1306_list_reset(&list);
+    i2c_ssd1306_list_clear(&list, true);
+    i2c_ssd1306_list_sprite(&list, 0, 0, &bell, SSD1306_ROP_XOR + 1);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_list_submit(&i2c_ssd1306, &list));
+    TEST_ASSERT_EQUAL_HEX8(0x00, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, i2c_ssd1306.framebuffer, FRAME_SIZE);
+}
+
+static void test_dirty_tracking(void)
+{
+    i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+    TEST_ASSERT_EQUAL_HEX8(0x00, i2c_ssd1306.dirty.pages);
+
+    i2c_ssd1306_buffer_text(&i2c_ssd1306, 28, 22, "Count: 42", false);
+    TEST_ASSERT_EQUAL_HEX8(0x0C, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(28, i2c_ssd1306.dirty.start[2]);
+    TEST_ASSERT_EQUAL(28 + 9 * 8 - 1, i2c_ssd1306.dirty.end[2]);
+    TEST_ASSERT_EQUAL(28, i2c_ssd1306.dirty.start[3]);
+    TEST_ASSERT_EQUAL(28 + 9 * 8 - 1, i2c_ssd1306.dirty.end[3]);
+
+    i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, 3, 17, true);
+    TEST_ASSERT_EQUAL(3, i2c_ssd1306.dirty.start[2]);
+}
+
+static void test_invalid_arguments(void)
+{
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_text(&i2c_ssd1306, 128, 0, "x", false));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_text(&i2c_ssd1306, 0, 0, "", false));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_fill_pixel(&i2c_ssd1306, 0, 32, true));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_fill_space(&i2c_ssd1306, 5, 4, 0, 0, true));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_image(&i2c_ssd1306, 0, 0, NULL, 8, 8, false));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_text_font(&i2c_ssd1306, 0, 0, "x", NULL, false, SSD1306_ROP_OR));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_polygon(&i2c_ssd1306, NULL, 3, true));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_sprite(&i2c_ssd1306, 0, 0, NULL, SSD1306_ROP_OR));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_buffer_text_rop(&i2c_ssd1306, 0, 0, "x", false, SSD1306_ROP_XOR));
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_text);
+    RUN_TEST(test_text_copy);
+    RUN_TEST(test_text_font);
+    RUN_TEST(test_text_font_copy);
+    RUN_TEST(test_text_font_width);
+    RUN_TEST(test_image);
+    RUN_TEST(test_image_unaligned);
+    RUN_TEST(test_image_asset);
+    RUN_TEST(test_image_asset_encodings);
+    RUN_TEST(test_sprite);
+    RUN_TEST(test_sprite_xor_restores);
+    RUN_TEST(test_fill_space);
+    RUN_TEST(test_shapes);
+    RUN_TEST(test_shapes_clipped);
+    RUN_TEST(test_display_list);
+    RUN_TEST(test_dirty_tracking);
+    RUN_TEST(test_invalid_arguments);
+    return UNITY_END();
+}
@@ -0,0 +1,174 @@
+#include <unity.h>
+#include "i2c_mock_display.h"
+
+/*
+ * Retained widget tests: what a widget draws, and that updates only redraw and flush the widget's own box.
+ * Expected pixels come from the immediate-mode drawing functions on a second display.
+ */
+
+static i2c_master_bus_handle_t i2c_master_bus;
+static i2c_ssd1306_handle_t i2c_ssd1306;
+static i2c_ssd1306_handle_t reference;
+
+static void init_display(i2c_ssd1306_handle_t *display, uint16_t device_address)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_mock_init_display_at(device_address, 128, 32, SSD1306_ADDRESSING_HORIZONTAL, &i2c_master_bus, display));
+}
+
+static void assert_matches_reference(void)
+{
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(reference.framebuffer, i2c_ssd1306.framebuffer, 128 * 32 / 8);
+}
+
+void setUp(void)
+{
+    i2c_mock_reset_all();
+    init_display(&i2c_ssd1306, 0x3C);
+    init_display(&reference, 0x3D);
+    i2c_ssd1306_buffer_to_ram(&i2c_ssd1306);
+    i2c_mock_reset();
+}
+
+void tearDown(void)
+{
+    i2c_ssd1306_deinit(&i2c_ssd1306);
+    i2c_ssd1306_deinit(&reference);
+}
+
+static void test_value_redraws_only_its_box(void)
+{
+    i2c_ssd1306_widget_t title, count;
+    i2c_ssd1306_widget_config_t title_config = {.x = 20, .y = 0, .width = 64, .height = 8};
+    i2c_ssd1306_widget_config_t count_config = {.x = 16, .y = 22, .width = 96, .height = 8, .align = SSD1306_ALIGN_CENTER};
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_label(&title, &i2c_ssd1306, &title_config, "ESP32-S3"));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_value(&count, &i2c_ssd1306, &count_config, "Count: ", NULL, 9));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+
+    i2c_mock_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_set_value(&count, 10));
+    TEST_ASSERT_EQUAL_HEX8(0x0C, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(16, i2c_ssd1306.dirty.start[2]);
+    TEST_ASSERT_EQUAL(111, i2c_ssd1306.dirty.end[3]);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    /* One window command and one data run per page of the 96-column box. */
+    TEST_ASSERT_EQUAL(3, i2c_mock_transaction_count());
+    TEST_ASSERT_EQUAL(8 + 2 * (2 + 96), i2c_ssd1306.flush_wire_bytes);
+
+    i2c_ssd1306_buffer_text(&reference, 20, 0, "ESP32-S3", false);
+    i2c_ssd1306_buffer_text(&reference, 28, 22, "Count: 10", false);
+    assert_matches_reference();
+}
+
+static void test_unchanged_content_sends_nothing(void)
+{
+    i2c_ssd1306_widget_t label, count, bar;
+    i2c_ssd1306_widget_config_t label_config = {.x = 0, .y = 0, .width = 64, .height = 8};
+    i2c_ssd1306_widget_config_t count_config = {.x = 0, .y = 8, .width = 64, .height = 8};
+    i2c_ssd1306_widget_config_t bar_config = {.x = 0, .y = 16, .width = 104, .height = 8};
+    i2c_ssd1306_widget_label(&label, &i2c_ssd1306, &label_config, "Idle");
+    i2c_ssd1306_widget_value(&count, &i2c_ssd1306, &count_config, NULL, NULL, 5);
+    i2c_ssd1306_widget_bar(&bar, &i2c_ssd1306, &bar_config, 0, 1000, 500);
+    i2c_ssd1306_dirty_to_ram(&i2c_ssd1306);
+
+    i2c_mock_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_set_text(&label, "Idle"));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_set_value(&count, 5));
+    /* 100 inner columns: 501 fills the same 50 columns as 500. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_set_value(&bar, 501));
+    TEST_ASSERT_EQUAL_HEX8(0x00, i2c_ssd1306.dirty.pages);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_dirty_to_ram(&i2c_ssd1306));
+    TEST_ASSERT_EQUAL(0, i2c_mock_transaction_count());
+}
+
+static void test_label_alignment_and_truncation(void)
+{
+    i2c_ssd1306_widget_t right, centered, clipped;
+    i2c_ssd1306_widget_config_t right_config = {.x = 0, .y = 0, .width = 40, .height = 8, .align = SSD1306_ALIGN_RIGHT};
+    i2c_ssd1306_widget_config_t centered_config = {.x = 48, .y = 0, .width = 80, .height = 20, .align = SSD1306_ALIGN_CENTER, .font = &ssd1306_font_16};
+    i2c_ssd1306_widget_config_t clipped_config = {.x = 0, .y = 24, .width = 44, .height = 8, .invert = true};
+    i2c_ssd1306_widget_label(&right, &i2c_ssd1306, &right_config, "OK");
+    i2c_ssd1306_widget_label(&centered, &i2c_ssd1306, &centered_config, "21°");
+    i2c_ssd1306_widget_label(&clipped, &i2c_ssd1306, &clipped_config, "ABCDEFGHIJ");
+
+    i2c_ssd1306_buffer_text(&reference, 24, 0, "OK", false);
+    uint16_t width = ssd1306_font_text_width(&ssd1306_font_16, "21°");
+    i2c_ssd1306_buffer_text_font(&reference, 48 + (80 - width) / 2, 2, "21°", &ssd1306_font_16, false, SSD1306_ROP_COPY);
+    /* Five whole glyphs fit the 44 columns; the rest of the lit box stays lit. */
+    i2c_ssd1306_buffer_fill_space(&reference, 0, 43, 24, 31, true);
+    i2c_ssd1306_buffer_text_rop(&reference, 0, 24, "ABCDE", true, SSD1306_ROP_COPY);
+    assert_matches_reference();
+    TEST_ASSERT_EQUAL(43, i2c_ssd1306.dirty.end[3]);
+
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_set_text(&right, "A"));
+    i2c_ssd1306_buffer_fill_space(&reference, 0, 39, 0, 7, false);
+    i2c_ssd1306_buffer_text(&reference, 32, 0, "A", false);
+    assert_matches_reference();
+}
+
+static const uint8_t bell_bitmap[] = {0x18, 0x3C, 0x7E, 0x3C, 0x18};
+static const ssd1306_sprite_t bell = {.width = 5, .height = 8, .bitmap = bell_bitmap};
+
+static void test_bar_and_icon(void)
+{
+    i2c_ssd1306_widget_t bar, icon;
+    i2c_ssd1306_widget_config_t bar_config = {.x = 10, .y = 4, .width = 44, .height = 9};
+    i2c_ssd1306_widget_config_t icon_config = {.x = 64, .y = 16, .width = 16, .height = 16, .align = SSD1306_ALIGN_CENTER};
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_bar(&bar, &i2c_ssd1306, &bar_config, -50, 50, 0));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_icon(&icon, &i2c_ssd1306, &icon_config, &bell));
+
+    i2c_ssd1306_buffer_round_rect(&reference, 10, 4, 44, 9, 0, true);
+    i2c_ssd1306_buffer_fill_space(&reference, 12, 31, 6, 10, true);
+    i2c_ssd1306_buffer_sprite(&reference, 69, 20, &bell, SSD1306_ROP_OR);
+    assert_matches_reference();
+
+    /* Out-of-range values clamp to a full bar; clearing the sprite empties the icon's box. */
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_set_value(&bar, 80));
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_set_sprite(&icon, NULL));
+    i2c_ssd1306_buffer_fill_space(&reference, 12, 51, 6, 10, true);
+    i2c_ssd1306_buffer_sprite(&reference, 69, 20, &bell, SSD1306_ROP_AND_NOT);
+    assert_matches_reference();
+}
+
+static void test_redraw_after_clear(void)
+{
+    i2c_ssd1306_widget_t count;
+    i2c_ssd1306_widget_config_t count_config = {.x = 0, .y = 0, .width = 128, .height = 8};
+    i2c_ssd1306_widget_value(&count, &i2c_ssd1306, &count_config, "T=", "°C", -2147483647 - 1);
+    i2c_ssd1306_buffer_clear(&i2c_ssd1306);
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_redraw(&count));
+
+    i2c_ssd1306_buffer_text(&reference, 0, 0, "T=-2147483648", false);
+    i2c_ssd1306_buffer_text_font(&reference, 104, 0, "°C", &ssd1306_font_8x8, false, SSD1306_ROP_OR);
+    assert_matches_reference();
+}
+
+static void test_invalid_arguments(void)
+{
+    i2c_ssd1306_widget_t widget;
+    i2c_ssd1306_widget_config_t outside = {.x = 100, .y = 0, .width = 29, .height = 8};
+    i2c_ssd1306_widget_config_t too_low = {.x = 0, .y = 0, .width = 64, .height = 12, .font = &ssd1306_font_16};
+    i2c_ssd1306_widget_config_t small = {.x = 0, .y = 0, .width = 4, .height = 8};
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_widget_label(&widget, &i2c_ssd1306, &outside, "x"));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_widget_value(&widget, &i2c_ssd1306, &too_low, NULL, NULL, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_widget_icon(&widget, &i2c_ssd1306, &small, &bell));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_widget_bar(&widget, &i2c_ssd1306, &small, 0, 10, 0));
+
+    small.width = 8;
+    TEST_ASSERT_EQUAL(ESP_OK, i2c_ssd1306_widget_bar(&widget, &i2c_ssd1306, &small, 0, 10, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_widget_set_text(&widget, "x"));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, i2c_ssd1306_widget_set_sprite(&widget, &bell));
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_value_redraws_only_its_box);
+    RUN_TEST(test_unchanged_content_sends_nothing);
+    RUN_TEST(test_label_alignment_and_truncation);
+    RUN_TEST(test_bar_and_icon);
+    RUN_TEST(test_redraw_after_clear);
+    RUN_TEST(test_invalid_arguments);
+    return UNITY_END();
+}
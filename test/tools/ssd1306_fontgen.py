@@ -0,0 +1,422 @@
+#!/usr/bin/env python3
+"""Generate compact SSD1306 fonts (see lib/ssd1306/ssd1306_font.h) from BDF or TrueType fonts.
+
+Glyphs are stored as page-major strips: 'height / 8' rows of 'width' column bytes, LSB at the top, so the
+renderer can blit every strip straight into a framebuffer page. Only the requested code point ranges are kept,
+trailing empty columns are trimmed and identical strips are shared.
+
+    ssd1306_fontgen.py --bdf fonts/font8x8.bdf --height 8 --monospace --fallback 32 --name ssd1306_font_8x8 -o ../lib/ssd1306/fonts/ssd1306_font_8x8.c
+    ssd1306_fontgen.py --bdf fonts/font8x8.bdf --height 8 --proportional --name ssd1306_font_8 -o ../lib/ssd1306/fonts/ssd1306_font_8.c
+    ssd1306_fontgen.py --ttf DejaVuSans.ttf --height 16 --name ssd1306_font_dejavu_16 -o ../lib/ssd1306/fonts/ssd1306_font_dejavu_16.c
+
+TrueType outlines are rasterized here without hinting (no third-party modules needed): the font is scaled so
+that ascender to descender fills 'height' rows and pixels with at least --threshold coverage are set.
+"""
+
+import argparse
+import struct
+import sys
+
+
+# ---------------------------------------------------------------------------------------------------------------------
+# BDF
+
+
+def load_bdf(path, height):
+    """Return {code point: (advance, rows)} with 'rows' a list of 'height' strings of '#'/'.' starting at the pen."""
+    glyphs = {}
+    ascent = None
+    with open(path, encoding="latin-1") as bdf:
+        lines = iter(bdf.read().splitlines())
+    for line in lines:
+        if line.startswith("FONT_ASCENT"):
+            ascent = int(line.split()[1])
+        if not line.startswith("STARTCHAR"):
+            continue
+        encoding, advance, bbx = None, 0, (0, 0, 0, 0)
+        for line in lines:
+            if line.startswith("ENCODING"):
+                encoding = int(line.split()[1])
+            elif line.startswith("DWIDTH"):
+                advance = int(line.split()[1])
+            elif line.startswith("BBX"):
+                bbx = tuple(int(v) for v in line.split()[1:5])
+            elif line == "BITMAP":
+                break
+        width, rows_count, x_offset, y_offset = bbx
+        bitmap = []
+        for line in lines:
+            if line == "ENDCHAR":
+                break
+            bits = int(line, 16)
+            bitmap.append([(bits >> (len(line) * 4 - 1 - i)) & 1 for i in range(width)])
+        if encoding is None or encoding < 0:
+            continue
+        if ascent is None:
+            sys.exit("BDF font without FONT_ASCENT")
+        # Row 0 of the cell is 'ascent' pixels above the baseline.
+        top = ascent - (y_offset + rows_count)
+        cell_width = max(advance, x_offset + width)
+        rows = [["."] * cell_width for _ in range(height)]
+        for r, bits in enumerate(bitmap):
+            y = top + r
+            if 0 <= y < height:
+                for c, bit in enumerate(bits):
+                    if bit and 0 <= x_offset + c < cell_width:
+                        rows[y][x_offset + c] = "#"
+        glyphs[encoding] = (advance, ["".join(row) for row in rows])
+    return glyphs
+
+
+# ---------------------------------------------------------------------------------------------------------------------
+# TrueType
+
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as ttf:
+            self.data = ttf.read()
+        num_tables = struct.unpack_from(">H", self.data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        head = self.tables["head"][0]
+        self.units_per_em = struct.unpack_from(">H", self.data, head + 18)[0]
+        self.long_loca = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+        hhea = self.tables["hhea"][0]
+        self.ascender, self.descender = struct.unpack_from(">hh", self.data, hhea + 4)
+        self.num_h_metrics = struct.unpack_from(">H", self.data, hhea + 34)[0]
+        self.num_glyphs = struct.unpack_from(">H", self.data, self.tables["maxp"][0] + 4)[0]
+        self.cmap = self._load_cmap()
+
+    def _load_cmap(self):
+        cmap = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, cmap + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", self.data, cmap + 4 + 8 * i)
+            sub = cmap + offset
+            if (platform, encoding) in ((3, 1), (0, 3)) and struct.unpack_from(">H", self.data, sub)[0] == 4:
+                return self._load_cmap4(sub)
+        sys.exit("TrueType font without a format 4 Unicode cmap")
+
+    def _load_cmap4(self, sub):
+        seg_count = struct.unpack_from(">H", self.data, sub + 6)[0] // 2
+        ends = sub + 14
+        starts = ends + 2 * seg_count + 2
+        deltas = starts + 2 * seg_count
+        range_offsets = deltas + 2 * seg_count
+        mapping = {}
+        for s in range(seg_count):
+            end = struct.unpack_from(">H", self.data, ends + 2 * s)[0]
+            start = struct.unpack_from(">H", self.data, starts + 2 * s)[0]
+            delta = struct.unpack_from(">h", self.data, deltas + 2 * s)[0]
+            range_offset = struct.unpack_from(">H", self.data, range_offsets + 2 * s)[0]
+            for code in range(start, min(end, 0xFFFE) + 1):
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    at = range_offsets + 2 * s + range_offset + 2 * (code - start)
+                    glyph = struct.unpack_from(">H", self.data, at)[0]
+                    if glyph:
+                        glyph = (glyph + delta) & 0xFFFF
+                if glyph:
+                    mapping[code] = glyph
+        return mapping
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        return struct.unpack_from(">H", self.data, hmtx + 4 * min(glyph, self.num_h_metrics - 1))[0]
+
+    def _glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = struct.unpack_from(">II", self.data, loca + 4 * glyph)
+        else:
+            start, end = (2 * v for v in struct.unpack_from(">HH", self.data, loca + 2 * glyph))
+        return self.tables["glyf"][0] + start, end - start
+
+    def y_bounds(self, glyph):
+        offset, length = self._glyph_range(glyph)
+        if length == 0:
+            return 0, 0
+        y_min, _, y_max = struct.unpack_from(">hhh", self.data, offset + 4)
+        return y_min, y_max
+
+    def contours(self, glyph, dx=0, dy=0):
+        """Outline of 'glyph' as a list of contours of (x, y, on_curve) points in font units."""
+        offset, length = self._glyph_range(glyph)
+        if length == 0:
+            return []
+        num_contours = struct.unpack_from(">h", self.data, offset)[0]
+        at = offset + 10
+        if num_contours < 0:
+            return self._composite(at, dx, dy)
+        ends = struct.unpack_from(">%dH" % num_contours, self.data, at)
+        at += 2 * num_contours
+        at += 2 + struct.unpack_from(">H", self.data, at)[0]
+        count = ends[-1] + 1
+        flags = []
+        while len(flags) < count:
+            flag = self.data[at]
+            at += 1
+            flags.append(flag)
+            if flag & 8:
+                flags.extend([flag] * self.data[at])
+                at += 1
+        coords = []
+        for short_bit, same_bit in ((2, 16), (4, 32)):
+            value, values = 0, []
+            for flag in flags:
+                if flag & short_bit:
+                    step = self.data[at]
+                    at += 1
+                    value += step if flag & same_bit else -step
+                elif not flag & same_bit:
+                    value += struct.unpack_from(">h", self.data, at)[0]
+                    at += 2
+                values.append(value)
+            coords.append(values)
+        points = [(x + dx, y + dy, bool(f & 1)) for x, y, f in zip(coords[0], coords[1], flags)]
+        contours, start = [], 0
+        for end in ends:
+            contours.append(points[start:end + 1])
+            start = end + 1
+        return contours
+
+    def _composite(self, at, dx, dy):
+        contours = []
+        while True:
+            flags, glyph = struct.unpack_from(">HH", self.data, at)
+            at += 4
+            if flags & 1:
+                x, y = struct.unpack_from(">hh", self.data, at)
+                at += 4
+            else:
+                x, y = struct.unpack_from(">bb", self.data, at)
+                at += 2
+            # Scaled components are not used by the supported fonts; skip their transform.
+            at += 2 if flags & 8 else 4 if flags & 0x40 else 8 if flags & 0x80 else 0
+            contours += self.contours(glyph, dx + x, dy + y) if flags & 2 else []
+            if not flags & 0x20:
+                return contours
+
+
+def flatten(contour, steps=8):
+    """Turn a quadratic TrueType contour into a closed polyline."""
+    points = list(contour)
+    if not any(on for _, _, on in points):
+        points.insert(0, ((points[0][0] + points[-1][0]) / 2, (points[0][1] + points[-1][1]) / 2, True))
+    while not points[0][2]:
+        points.append(points.pop(0))
+    points.append(points[0])
+    polyline = [points[0][:2]]
+    control = None
+    for x, y, on in points[1:]:
+        if on:
+            if control is None:
+                polyline.append((x, y))
+            else:
+                x0, y0 = polyline[-1]
+                cx, cy = control
+                for i in range(1, steps + 1):
+                    t = i / steps
+                    polyline.append(((1 - t) ** 2 * x0 + 2 * (1 - t) * t * cx + t * t * x,
+                                     (1 - t) ** 2 * y0 + 2 * (1 - t) * t * cy + t * t * y))
+                control = None
+        else:
+            if control is not None:
+                # Two off-curve points imply an on-curve point halfway.
+                mid = ((control[0] + x) / 2, (control[1] + y) / 2)
+                x0, y0 = polyline[-1]
+                cx, cy = control
+                for i in range(1, steps + 1):
+                    t = i / steps
+                    polyline.append(((1 - t) ** 2 * x0 + 2 * (1 - t) * t * cx + t * t * mid[0],
+                                     (1 - t) ** 2 * y0 + 2 * (1 - t) * t * cy + t * t * mid[1]))
+            control = (x, y)
+    return polyline
+
+
+def rasterize(polylines, width, height, threshold, samples=8):
+    """Nonzero-winding coverage of 'polylines' (pixel coordinates, y down) thresholded into '#'/'.' rows."""
+    coverage = [[0.0] * width for _ in range(height)]
+    edges = []
+    for polyline in polylines:
+        for (x0, y0), (x1, y1) in zip(polyline, polyline[1:]):
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+    for row in range(height):
+        for s in range(samples):
+            y = row + (s + 0.5) / samples
+            crossings = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= y < y1) or (y1 <= y < y0):
+                    crossings.append((x0 + (y - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+            crossings.sort()
+            winding = 0
+            for (xa, direction), (xb, _) in zip(crossings, crossings[1:] + [(0, 0)]):
+                winding += direction
+                if winding == 0 or xb <= xa:
+                    continue
+                for col in range(max(0, int(xa)), min(width, int(xb) + 1)):
+                    overlap = min(xb, col + 1) - max(xa, col)
+                    if overlap > 0:
+                        coverage[row][col] += overlap / samples
+    return ["".join("#" if c >= threshold else "." for c in row) for row in coverage]
+
+
+def load_ttf(path, height, code_points, threshold):
+    ttf = TrueType(path)
+    # Fit the ink of the requested glyphs rather than the line gap of the whole font, the panel has no pixels to spare.
+    bounds = [ttf.y_bounds(ttf.cmap[code]) for code in code_points if code in ttf.cmap]
+    top = max(y_max for _, y_max in bounds)
+    bottom = min(y_min for y_min, _ in bounds)
+    scale = height / (top - bottom)
+    baseline = round(top * scale)
+    glyphs = {}
+    for code in code_points:
+        glyph = ttf.cmap.get(code)
+        if glyph is None:
+            continue
+        advance = round(ttf.advance(glyph) * scale)
+        polylines = [[(x * scale, baseline - y * scale) for x, y in flatten(contour)] for contour in ttf.contours(glyph)]
+        right = max([advance] + [int(x) + 1 for polyline in polylines for x, _ in polyline])
+        glyphs[code] = (advance, rasterize(polylines, right, height, threshold))
+    return glyphs
+
+
+# ---------------------------------------------------------------------------------------------------------------------
+# Packing
+
+
+def parse_ranges(text):
+    code_points = []
+    for part in text.split(","):
+        first, _, last = part.partition("-")
+        first = int(first, 0)
+        code_points += range(first, (int(last, 0) if last else first) + 1)
+    return code_points
+
+
+def strips(rows, width, pages):
+    """Page-major column bytes of the first 'width' columns of 'rows', LSB at the top."""
+    data = []
+    for page in range(pages):
+        for col in range(width):
+            byte = 0
+            for bit in range(8):
+                row = rows[page * 8 + bit]
+                if col < len(row) and row[col] == "#":
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def proportional(glyphs):
+    """Trim the blank columns in front of every glyph and advance by its ink plus one column."""
+    for code, (advance, rows) in glyphs.items():
+        ink = [i for row in rows for i, pixel in enumerate(row) if pixel == "#"]
+        if not ink:
+            glyphs[code] = (max(1, advance // 2), rows)
+            continue
+        rows = [row[min(ink):] for row in rows]
+        glyphs[code] = (max(ink) - min(ink) + 2, rows)
+
+
+def pack(glyphs, code_points, height, monospace):
+    pages = height // 8
+    code_points = [code for code in code_points if code in glyphs]
+    ranges = []
+    for code in code_points:
+        if ranges and ranges[-1][0] + ranges[-1][1] == code:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([code, 1, len([c for c in code_points if c < code])])
+    bitmaps, entries, shared = [], [], {}
+    for code in code_points:
+        advance, rows = glyphs[code]
+        width = max([0] + [len(row.rstrip(".")) for row in rows])
+        if monospace:
+            width = advance
+        data = tuple(strips(rows, width, pages))
+        if data not in shared:
+            shared[data] = len(bitmaps)
+            bitmaps += data
+        entries.append((shared[data], width, advance, code))
+    return ranges, entries, bitmaps
+
+
+def emit(args, ranges, entries, bitmaps):
+    name = args.name
+    fallback = next((i for i, entry in enumerate(entries) if entry[3] == args.fallback), 0)
+    out = []
+    out.append("/* Generated by tools/ssd1306_fontgen.py from %s; do not edit. */" % args.source)
+    out.append("")
+    out.append('#include "ssd1306_font.h"')
+    out.append("")
+    out.append("static const uint8_t %s_bitmaps[%d] __attribute__((aligned(4))) = {" % (name, len(bitmaps)))
+    for i in range(0, len(bitmaps), 16):
+        out.append("    " + ", ".join("0x%02X" % b for b in bitmaps[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("static const ssd1306_glyph_t %s_glyphs[%d] = {" % (name, len(entries)))
+    for offset, width, advance, code in entries:
+        label = chr(code) if 32 < code < 127 and chr(code) not in "\\" else "U+%04X" % code
+        out.append("    {%d, %d, %d}, // %s" % (offset, width, advance, label))
+    out.append("};")
+    out.append("")
+    out.append("static const ssd1306_font_range_t %s_ranges[%d] = {" % (name, len(ranges)))
+    for first, count, glyph in ranges:
+        out.append("    {0x%04X, %d, %d}," % (first, count, glyph))
+    out.append("};")
+    out.append("")
+    out.append("const ssd1306_font_t %s = {" % name)
+    out.append("    .height = %d," % args.height)
+    out.append("    .range_count = %d," % len(ranges))
+    out.append("    .fallback = %d," % fallback)
+    out.append("    .ranges = %s_ranges," % name)
+    out.append("    .glyphs = %s_glyphs," % name)
+    out.append("    .bitmaps = %s_bitmaps};" % name)
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--bdf", help="BDF font to convert")
+    source.add_argument("--ttf", help="TrueType font to rasterize")
+    parser.add_argument("--height", type=int, required=True, choices=(8, 16, 24, 32), help="glyph height in pixels")
+    parser.add_argument("--ranges", default="32-126", help="code points to keep, e.g. 32-126,176")
+    parser.add_argument("--fallback", type=lambda v: int(v, 0), default=ord("?"), help="code point drawn for unmapped ones")
+    parser.add_argument("--monospace", action="store_true", help="keep every glyph as wide as its advance")
+    parser.add_argument("--proportional", action="store_true", help="derive advances from the ink of monospace glyphs")
+    parser.add_argument("--threshold", type=float, default=0.5, help="TrueType pixel coverage that sets a pixel")
+    parser.add_argument("--name", required=True, help="C symbol of the font")
+    parser.add_argument("-o", "--output", required=True, help="C file to write")
+    parser.add_argument("--preview", action="store_true", help="print the glyphs as text")
+    args = parser.parse_args()
+
+    code_points = parse_ranges(args.ranges)
+    if args.bdf:
+        args.source = args.bdf.replace("\\", "/").split("/")[-1]
+        glyphs = load_bdf(args.bdf, args.height)
+    else:
+        args.source = args.ttf.replace("\\", "/").split("/")[-1]
+        glyphs = load_ttf(args.ttf, args.height, code_points, args.threshold)
+
+    if args.proportional:
+        proportional(glyphs)
+    ranges, entries, bitmaps = pack(glyphs, code_points, args.height, args.monospace)
+    if args.preview:
+        for offset, width, advance, code in entries:
+            print("U+%04X advance %d" % (code, advance))
+            print("\n".join(row[:width] for row in glyphs[code][1]))
+    with open(args.output, "w") as out:
+        out.write(emit(args, ranges, entries, bitmaps))
+    size = len(bitmaps) + 4 * len(entries) + 6 * len(ranges)
+    print("%s: %d glyphs in %d ranges, %d bytes" % (args.name, len(entries), len(ranges), size))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Generate const SSD1306 image assets (see lib/ssd1306/ssd1306_image.h) from PNG files.
+
+Pixels are thresholded to 1bpp and packed like the framebuffer: page-major strips of 'width' column bytes, LSB at
+the top. The strips are stored raw or run-length encoded, whichever is smaller unless --encoding says otherwise, and
+i2c_ssd1306_buffer_image_asset() decodes them straight into the framebuffer.
+
+    ssd1306_imagegen.py images/ssd1306_logo.png --name ssd1306_logo -o ../lib/ssd1306/images/ssd1306_logo.c
+    ssd1306_imagegen.py splash.png --invert --threshold 0.3 --name splash -o ../src/splash.c
+
+Lit pixels are the light ones (luminance at least --threshold) that are at least half opaque. The PNG reader
+needs no third-party modules and takes every non-interlaced PNG.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+
+# ---------------------------------------------------------------------------------------------------------------------
+# PNG
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def unfilter(data, width, height, bpp, stride):
+    """Undo the per-scanline filters; 'bpp' is bytes per complete pixel, rounded up."""
+    rows, previous, at = [], bytearray(stride), 0
+    for _ in range(height):
+        kind = data[at]
+        row = bytearray(data[at + 1:at + 1 + stride])
+        at += 1 + stride
+        for i in range(stride):
+            left = row[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + previous[i]) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((left + previous[i]) >> 1)) & 0xFF
+            elif kind == 4:
+                row[i] = (row[i] + paeth(left, previous[i], previous[i - bpp] if i >= bpp else 0)) & 0xFF
+            elif kind != 0:
+                sys.exit("PNG with an unknown filter %d" % kind)
+        rows.append(row)
+        previous = row
+    return rows
+
+
+def load_png(path):
+    """Return (width, height, pixels) with 'pixels' rows of (luminance, alpha) pairs in 0..255."""
+    with open(path, "rb") as png:
+        data = png.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s is not a PNG file" % path)
+    at, idat, palette, transparency = 8, b"", [], b""
+    while at < len(data):
+        length, kind = struct.unpack_from(">I4s", data, at)
+        body = data[at + 8:at + 8 + length]
+        at += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            transparency = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    if interlace:
+        sys.exit("Interlaced PNG files are not supported, save %s without interlacing" % path)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = depth * channels
+    rows = unfilter(zlib.decompress(idat), width, height, max(1, bits // 8), (width * bits + 7) // 8)
+    pixels = []
+    for row in rows:
+        if depth == 16:
+            samples = [row[i] for i in range(0, len(row), 2)]
+            depth_max = 255
+        elif depth < 8:
+            samples = [(row[i // (8 // depth)] >> (8 - depth * (1 + i % (8 // depth)))) & ((1 << depth) - 1)
+                       for i in range(width * channels)]
+            depth_max = (1 << depth) - 1
+        else:
+            samples = list(row)
+            depth_max = 255
+        line = []
+        for x in range(width):
+            sample = samples[x * channels:(x + 1) * channels]
+            if color == 3:
+                r, g, b = palette[sample[0]]
+                alpha = transparency[sample[0]] if sample[0] < len(transparency) else 255
+            else:
+                scaled = [s * 255 // depth_max for s in sample]
+                r, g, b = scaled[:3] if color in (2, 6) else scaled[:1] * 3
+                alpha = scaled[-1] if color in (4, 6) else 255
+            line.append(((299 * r + 587 * g + 114 * b) // 1000, alpha))
+        pixels.append(line)
+    return width, height, pixels
+
+
+# ---------------------------------------------------------------------------------------------------------------------
+# Packing
+
+
+def strips(pixels, width, height, threshold, invert):
+    """Page-major column bytes of the image, LSB at the top; rows below 'height' in the last strip stay clear."""
+    data = []
+    for page in range((height + 7) // 8):
+        for col in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height:
+                    luminance, alpha = pixels[y][col]
+                    lit = alpha >= 128 and luminance >= threshold * 255
+                    if lit != invert:
+                        byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def rle(data):
+    """Packets of ssd1306_image.h: runs of 3..130 equal bytes, literals of 1..128 bytes in between."""
+    out, literal, i = [], [], 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 130 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            if literal:
+                out += [len(literal) - 1] + literal
+                literal = []
+            out += [0x80 + run - 3, data[i]]
+            i += run
+            continue
+        literal.append(data[i])
+        i += 1
+        if len(literal) == 128:
+            out += [127] + literal
+            literal = []
+    if literal:
+        out += [len(literal) - 1] + literal
+    return out
+
+
+def unrle(packets):
+    data, i = [], 0
+    while i < len(packets):
+        control = packets[i]
+        if control < 0x80:
+            data += packets[i + 1:i + 2 + control]
+            i += 2 + control
+        else:
+            data += [packets[i + 1]] * (control - 0x80 + 3)
+            i += 2
+    return data
+
+
+def emit(args, width, height, encoding, data):
+    name = args.name
+    out = []
+    out.append("/* Generated by tools/ssd1306_imagegen.py from %s; do not edit. */" % args.source)
+    out.append("")
+    out.append('#include "ssd1306_image.h"')
+    out.append("")
+    out.append("static const uint8_t %s_data[%d] = {" % (name, len(data)))
+    for i in range(0, len(data), 16):
+        out.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("const ssd1306_image_t %s = {" % name)
+    out.append("    .width = %d," % width)
+    out.append("    .height = %d," % height)
+    out.append("    .encoding = SSD1306_IMAGE_%s," % encoding.upper())
+    out.append("    .size = %d," % len(data))
+    out.append("    .data = %s_data};" % name)
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("png", help="PNG image to convert")
+    parser.add_argument("--threshold", type=float, default=0.5, help="luminance, 0..1, from which a pixel is lit")
+    parser.add_argument("--invert", action="store_true", help="light the dark pixels instead")
+    parser.add_argument("--encoding", choices=("auto", "raw", "rle"), default="auto", help="storage of the strips")
+    parser.add_argument("--name", required=True, help="C symbol of the image")
+    parser.add_argument("-o", "--output", required=True, help="C file to write")
+    parser.add_argument("--preview", action="store_true", help="print the image as text")
+    args = parser.parse_args()
+
+    args.source = args.png.replace("\\", "/").split("/")[-1]
+    width, height, pixels = load_png(args.png)
+    if not 0 < width <= 255 or not 0 < height <= 255:
+        sys.exit("%s is %dx%d, images are limited to 255x255" % (args.png, width, height))
+
+    raw = strips(pixels, width, height, args.threshold, args.invert)
+    packets = rle(raw)
+    assert unrle(packets) == raw
+    encoding = args.encoding
+    if encoding == "auto":
+        encoding = "rle" if len(packets) < len(raw) else "raw"
+    data = packets if encoding == "rle" else raw
+    if args.preview:
+        for y in range(height):
+            print("".join("#" if raw[(y // 8) * width + x] >> (y % 8) & 1 else "." for x in range(width)))
+    with open(args.output, "w") as out:
+        out.write(emit(args, width, height, encoding, data))
+    print("%s: %dx%d, %d bytes raw, %d bytes rle, stored %s" % (args.name, width, height, len(raw), len(packets), encoding))
+
+
+if __name__ == "__main__":
+    main()